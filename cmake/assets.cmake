@@ -0,0 +1,218 @@
+# Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+# SPDX-License-Identifier: Apache-2.0
+
+# Generated asset data is grouped in its own linker section within rodata
+zephyr_linker_sources(RODATA ${CMAKE_CURRENT_LIST_DIR}/assets.ld)
+
+# Pick the image format matching the only enabled render format, so images
+# are copied to the frame buffer without conversion.
+function(microui_image_format out)
+  # CONFIG_MICROUI_RENDER_* suffix and the matching image generator format
+  set(render_formats
+    RGB_888:RGB_888
+    ARGB_8888:ARGB_8888
+    RGB_565:RGB_565
+    RGB_565X:BGR_565
+    MONO:MONO01
+    L_8:L_8
+    AL_88:AL_88
+  )
+  set(formats)
+  foreach(entry ${render_formats})
+    string(REPLACE ":" ";" entry ${entry})
+    list(GET entry 0 render)
+    list(GET entry 1 format)
+    if(CONFIG_MICROUI_RENDER_${render})
+      list(APPEND formats ${format})
+    endif()
+  endforeach()
+
+  list(LENGTH formats count)
+  if(NOT count EQUAL 1)
+    set(${out} "" PARENT_SCOPE)
+  else()
+    set(${out} ${formats} PARENT_SCOPE)
+  endif()
+endfunction()
+
+# Generate a MicroUI font from a TTF/OTF file at build time and add it to the
+# application.
+#
+# microui_add_font(<name> TTF <font file> SIZE <pixels>
+#                  [RANGE <ranges>] [SUBSET <files>...])
+#
+# <name>   C identifier of the font descriptor, use MU_FONT_DECLARE(<name>)
+# RANGE    Characters to generate, e.g. "32-127". With SUBSET, characters to
+#          include in addition to the ones found, e.g. digits shown by printf.
+# SUBSET   Sources, gettext catalogs or text files. Only the characters used by
+#          their string literals (or text) are generated, and the font is
+#          regenerated when they change.
+function(microui_add_font name)
+  cmake_parse_arguments(FONT "" "TTF;SIZE;RANGE" "SUBSET" ${ARGN})
+
+  if(NOT FONT_TTF OR NOT FONT_SIZE)
+    message(FATAL_ERROR "microui_add_font(${name}): TTF and SIZE are required")
+  endif()
+
+  set(scripts_dir ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../scripts)
+  get_filename_component(ttf ${FONT_TTF} ABSOLUTE)
+  set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/microui)
+  set(output ${out_dir}/${name}.c)
+  set(gen_args -n ${name} --section .microui_assets.${name})
+  set(depends ${ttf} ${scripts_dir}/microui_font_gen.py)
+
+  if(FONT_SUBSET)
+    set(subset_files)
+    foreach(file ${FONT_SUBSET})
+      get_filename_component(file ${file} ABSOLUTE)
+      list(APPEND subset_files ${file})
+    endforeach()
+
+    set(subset_args)
+    if(FONT_RANGE)
+      set(subset_args -r ${FONT_RANGE})
+    endif()
+
+    set(range_file ${out_dir}/${name}_chars.txt)
+    add_custom_command(
+      OUTPUT ${range_file}
+      COMMAND ${CMAKE_COMMAND} -E make_directory ${out_dir}
+      COMMAND ${PYTHON_EXECUTABLE} ${scripts_dir}/microui_font_subset.py
+              ${subset_args} -o ${range_file} ${subset_files}
+      DEPENDS ${subset_files} ${scripts_dir}/microui_font_subset.py
+      COMMENT "Collecting characters used by MicroUI font ${name}"
+    )
+    list(APPEND gen_args --range-file ${range_file})
+    list(APPEND depends ${range_file})
+  elseif(FONT_RANGE)
+    list(APPEND gen_args -r ${FONT_RANGE})
+  endif()
+
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${out_dir}
+    COMMAND ${PYTHON_EXECUTABLE} ${scripts_dir}/microui_font_gen.py
+            ${gen_args} ${ttf} ${FONT_SIZE} ${output}
+    DEPENDS ${depends}
+    COMMENT "Generating MicroUI font ${name}"
+  )
+  add_custom_target(microui_font_${name} DEPENDS ${output})
+
+  target_sources(app PRIVATE ${output})
+endfunction()
+
+# Convert an image at build time and add it to the application.
+#
+# microui_add_image(<name> <image file> [FORMAT <format>]
+#                   [WIDTH <pixels>] [HEIGHT <pixels>])
+#
+# <name>   C identifier of the image descriptor, use MU_IMAGE_DECLARE(<name>)
+# FORMAT   Pixel format, see scripts/microui_image_gen.py. Defaults to the
+#          format of the only enabled CONFIG_MICROUI_RENDER_* option.
+# WIDTH    Resize the image to this width
+# HEIGHT   Resize the image to this height
+function(microui_add_image name image)
+  cmake_parse_arguments(IMAGE "" "FORMAT;WIDTH;HEIGHT" "" ${ARGN})
+
+  if(NOT IMAGE_FORMAT)
+    microui_image_format(IMAGE_FORMAT)
+    if(NOT IMAGE_FORMAT)
+      message(FATAL_ERROR "microui_add_image(${name}): FORMAT is required unless exactly "
+                          "one CONFIG_MICROUI_RENDER_* option is enabled")
+    endif()
+  endif()
+
+  set(scripts_dir ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../scripts)
+  get_filename_component(input ${image} ABSOLUTE)
+  set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/microui)
+  set(output ${out_dir}/${name}.c)
+  set(gen_args -n ${name} -f ${IMAGE_FORMAT} --section .microui_assets.${name})
+
+  if(IMAGE_WIDTH)
+    list(APPEND gen_args -w ${IMAGE_WIDTH})
+  endif()
+  if(IMAGE_HEIGHT)
+    list(APPEND gen_args -H ${IMAGE_HEIGHT})
+  endif()
+
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${out_dir}
+    COMMAND ${PYTHON_EXECUTABLE} ${scripts_dir}/microui_image_gen.py
+            ${gen_args} -i ${input} -o ${output}
+    DEPENDS ${input} ${scripts_dir}/microui_image_gen.py
+    COMMENT "Generating MicroUI image ${name} (${IMAGE_FORMAT})"
+  )
+  add_custom_target(microui_image_${name} DEPENDS ${output})
+
+  target_sources(app PRIVATE ${output})
+endfunction()
+
+# Generate a binary asset bundle, see include/microui/bundle.h. The structure
+# layout follows the configuration of the application. The bundle is not
+# linked into the application, flash it to its partition or file system.
+#
+# microui_add_bundle(<name> MANIFEST <manifest file> [BASE <address>])
+#
+# <name>    Written to microui/<name>.bin in the build directory
+# MANIFEST  JSON file listing the fonts and images, see
+#           scripts/microui_bundle_gen.py
+# BASE      Address the bundle is mapped at, e.g. of its XIP flash partition.
+#           Bundles generated for address 0 have to be relocated when loaded.
+function(microui_add_bundle name)
+  cmake_parse_arguments(BUNDLE "" "MANIFEST;BASE" "" ${ARGN})
+
+  if(NOT BUNDLE_MANIFEST)
+    message(FATAL_ERROR "microui_add_bundle(${name}): MANIFEST is required")
+  endif()
+
+  set(scripts_dir ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../scripts)
+  get_filename_component(manifest ${BUNDLE_MANIFEST} ABSOLUTE)
+  get_filename_component(manifest_dir ${manifest} DIRECTORY)
+  set(output ${CMAKE_CURRENT_BINARY_DIR}/microui/${name}.bin)
+
+  if(CONFIG_64BIT)
+    set(gen_args --pointer-size 8)
+  else()
+    set(gen_args --pointer-size 4)
+  endif()
+  if(CONFIG_MICROUI_FONT_KERNING)
+    list(APPEND gen_args --kerning)
+  endif()
+  if(CONFIG_MICROUI_ASSET_STORAGE)
+    list(APPEND gen_args --asset-storage)
+  endif()
+  if(BUNDLE_BASE)
+    list(APPEND gen_args --base ${BUNDLE_BASE})
+  endif()
+
+  # Regenerate when any font or image listed in the manifest changes
+  file(READ ${manifest} manifest_json)
+  set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${manifest})
+  set(depends ${manifest} ${scripts_dir}/microui_bundle_gen.py
+              ${scripts_dir}/microui_font_gen.py ${scripts_dir}/microui_image_gen.py)
+  foreach(kind fonts images)
+    string(JSON count ERROR_VARIABLE error LENGTH ${manifest_json} ${kind})
+    if(error)
+      continue()
+    endif()
+    if(count GREATER 0)
+      math(EXPR last "${count} - 1")
+      foreach(i RANGE ${last})
+        string(JSON file GET ${manifest_json} ${kind} ${i} file)
+        get_filename_component(file ${file} ABSOLUTE BASE_DIR ${manifest_dir})
+        list(APPEND depends ${file})
+      endforeach()
+    endif()
+  endforeach()
+
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/microui
+    COMMAND ${PYTHON_EXECUTABLE} ${scripts_dir}/microui_bundle_gen.py
+            ${gen_args} -o ${output} ${manifest}
+    DEPENDS ${depends}
+    COMMENT "Generating MicroUI asset bundle ${name}"
+  )
+  add_custom_target(microui_bundle_${name} ALL DEPENDS ${output})
+endfunction()
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file accel.h
+ * @brief MicroUI 2D Accelerator Interface
+ *
+ * Lets the renderer hand rectangle fills and image blits to a 2D engine such
+ * as a DMA2D. Operations may complete asynchronously: the renderer submits
+ * consecutive accelerated commands back to back and only waits for completion
+ * when the CPU has to access the frame buffer, i.e. before drawing a command
+ * in software and before presenting the frame.
+ *
+ * A backend leaves callbacks it does not implement NULL, and returns -ENOTSUP
+ * for operations it cannot perform, e.g. for a pixel format. Those commands
+ * are drawn in software.
+ *
+ * Pixel data has the memory layout used by the software renderer.
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_ACCEL_H_
+#define ZEPHYR_MODULES_MICROUI_ACCEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <zephyr/drivers/display.h>
+#include <microui/microui.h>
+#include <microui/image.h>
+
+/**
+ * @brief Frame buffer drawn to by the accelerator
+ */
+struct mu_AccelSurface {
+	uint8_t *buf;
+	/** Bytes per row */
+	uint32_t stride;
+	uint16_t width;
+	uint16_t height;
+	enum display_pixel_format format;
+};
+
+/**
+ * @brief 2D accelerator backend
+ *
+ * Rectangles are always within the surface and the source image. Operations
+ * complete in the order they were submitted.
+ */
+struct mu_Accel {
+	/**
+	 * Fill rect with an opaque pixel value, as stored by the software
+	 * renderer for the surface format.
+	 */
+	int (*fill)(const struct mu_Accel *accel, const struct mu_AccelSurface *dst, mu_Rect rect,
+		    uint32_t pixel);
+	/** Copy src_rect of an image in the surface format to pos */
+	int (*blit)(const struct mu_Accel *accel, const struct mu_AccelSurface *dst, mu_Vec2 pos,
+		    const struct mu_ImageDescriptor *src, mu_Rect src_rect);
+	/** Blend src_rect of an image with alpha channel onto the surface at pos */
+	int (*blend_blit)(const struct mu_Accel *accel, const struct mu_AccelSurface *dst,
+			  mu_Vec2 pos, const struct mu_ImageDescriptor *src, mu_Rect src_rect);
+	/** Copy src_rect of an opaque image in another format to pos, converting it */
+	int (*convert_blit)(const struct mu_Accel *accel, const struct mu_AccelSurface *dst,
+			    mu_Vec2 pos, const struct mu_ImageDescriptor *src, mu_Rect src_rect);
+	/** Block until all submitted operations have completed */
+	int (*wait)(const struct mu_Accel *accel);
+	/** Backend specific data */
+	void *user_data;
+};
+
+/**
+ * @brief Software reference backend.
+ *
+ * Implements fill and blit for formats of 8 bits per pixel and more, each
+ * completing before it returns. Conversion and blending are left to the
+ * renderer.
+ */
+extern const struct mu_Accel mu_accel_sw;
+
+/**
+ * @brief Set the accelerator used by the renderer.
+ *
+ * @param accel Backend, or NULL to render in software only
+ */
+void mu_accel_set(const struct mu_Accel *accel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_MODULES_MICROUI_ACCEL_H_ */
@@ -124,6 +124,61 @@ mu_Real mu_anim_ex(mu_Context *ctx, mu_AnimId id, mu_Real start, mu_Real end, ui
 mu_Real mu_anim(mu_Context *ctx, mu_AnimId id, mu_Real start, mu_Real end, uint32_t duration_ms,
 		enum mu_easing easing, bool loop);
 
+#if defined(CONFIG_MICROUI_ANIMATION_Q16) || defined(__DOXYGEN__)
+/**
+ * @brief Q16.16 fixed-point value
+ */
+typedef int32_t mu_q16;
+
+/** @brief The value 1.0 in Q16.16 */
+#define MU_Q16_ONE (1 << 16)
+
+/** @brief Convert an integer to Q16.16 */
+#define MU_Q16(x) ((mu_q16)(x) * MU_Q16_ONE)
+
+/** @brief Convert a Q16.16 value to an integer, rounding towards negative infinity */
+#define MU_Q16_TO_INT(q) ((int32_t)(q) >> 16)
+
+/**
+ * @brief Evaluate a built-in easing curve in fixed-point.
+ *
+ * Uses integer arithmetic only. The result is within 1/256 of the floating
+ * point curve used by mu_anim().
+ *
+ * @param easing Built-in easing type
+ * @param t      Progress from 0 to MU_Q16_ONE, clamped to that range
+ *
+ * @return Eased progress, may leave the 0 to MU_Q16_ONE range for elastic
+ *         and back curves
+ */
+mu_q16 mu_ease_q16(enum mu_easing easing, mu_q16 t);
+
+/**
+ * @brief Time-based fixed-point animation with built-in easing.
+ *
+ * Integer counterpart of mu_anim() for cores without an FPU. Never calls
+ * into the floating point library.
+ *
+ * @param ctx         MicroUI context
+ * @param id          Animation ID (use MU_ANIM_ID("name"))
+ * @param start       Starting value in Q16.16
+ * @param end         Ending value in Q16.16
+ * @param duration_ms Duration in milliseconds
+ * @param easing      Built-in easing type
+ * @param loop        Whether the animation should loop when finished
+ *
+ * @return Current interpolated value in Q16.16
+ *
+ * @code
+ * mu_q16 x = mu_anim_q16(ctx, MU_ANIM_ID("slide"), MU_Q16(0), MU_Q16(120), 300,
+ *                        MU_EASE_OUT_CUBIC, false);
+ * rect.x = MU_Q16_TO_INT(x);
+ * @endcode
+ */
+mu_q16 mu_anim_q16(mu_Context *ctx, mu_AnimId id, mu_q16 start, mu_q16 end, uint32_t duration_ms,
+		   enum mu_easing easing, bool loop);
+#endif /* CONFIG_MICROUI_ANIMATION_Q16 */
+
 /**
  * @brief Check if an animation has completed.
  *
@@ -172,6 +227,19 @@ uint32_t mu_anim_speed_to_time(mu_Real speed, mu_Real start, mu_Real end);
  */
 int mu_anim_count(mu_Context *ctx);
 
+/**
+ * @brief Check whether any animation is still in flight.
+ *
+ * An animation is in flight when it was evaluated during the current frame
+ * and has not reached its end value yet. Looping animations never finish.
+ * Containers still moving from kinetic scrolling count as in flight as well.
+ *
+ * @param ctx MicroUI context
+ *
+ * @return true if at least one animation needs further frames
+ */
+bool mu_anim_active(mu_Context *ctx);
+
 #ifdef __cplusplus
 }
 #endif
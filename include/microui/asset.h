@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file asset.h
+ * @brief MicroUI External Asset Storage
+ *
+ * Fonts and images normally point at directly addressable data. With an asset
+ * storage set in their descriptor, the glyph bitmap and pixel data pointers
+ * are offsets into that storage instead, e.g. a flash partition on external
+ * QSPI flash. The renderer reads the rows and glyphs it draws through a small
+ * read-ahead cache in RAM.
+ *
+ * @code
+ * MU_ASSET_STORAGE_PARTITION(album_storage, assets_partition);
+ *
+ * const struct mu_ImageDescriptor album = {
+ *     .width = 120,
+ *     .height = 120,
+ *     .stride = 240,
+ *     .data_size = 28800,
+ *     .data = MU_ASSET_OFFSET(0x1000),
+ *     .pixel_format = PIXEL_FORMAT_RGB_565,
+ *     .storage = &album_storage,
+ * };
+ * @endcode
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_ASSET_H_
+#define ZEPHYR_MODULES_MICROUI_ASSET_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef CONFIG_FLASH_MAP
+#include <zephyr/storage/flash_map.h>
+#endif /* CONFIG_FLASH_MAP */
+
+/**
+ * @brief Storage holding asset data that is not directly addressable
+ */
+struct mu_AssetStorage {
+	/**
+	 * Read len bytes at offset into buf, return 0 or a negative errno.
+	 * Called from the render thread.
+	 */
+	int (*read)(const struct mu_AssetStorage *storage, uint32_t offset, void *buf, size_t len);
+	/** Size of the storage in bytes, reads never go past it */
+	uint32_t size;
+	/** Backend specific, the flash area ID or the base address */
+	uintptr_t user_data;
+};
+
+/**
+ * @brief Offset into an asset storage, for the data pointers of descriptors
+ */
+#define MU_ASSET_OFFSET(offset) ((const uint8_t *)(uintptr_t)(offset))
+
+/**
+ * @brief Read backend for memory-mapped regions, see MU_ASSET_STORAGE_XIP()
+ */
+int mu_asset_xip_read(const struct mu_AssetStorage *storage, uint32_t offset, void *buf,
+		      size_t len);
+
+#if defined(CONFIG_FLASH_MAP) || defined(__DOXYGEN__)
+/**
+ * @brief Read backend for flash areas, see MU_ASSET_STORAGE_PARTITION()
+ */
+int mu_asset_flash_area_read(const struct mu_AssetStorage *storage, uint32_t offset, void *buf,
+			     size_t len);
+
+/**
+ * @brief Define an asset storage on a fixed flash partition.
+ *
+ * @param name  Name of the storage variable
+ * @param label Devicetree node label of the partition
+ */
+#define MU_ASSET_STORAGE_PARTITION(name, label)                                                    \
+	const struct mu_AssetStorage name = {                                                      \
+		.read = mu_asset_flash_area_read,                                                  \
+		.size = FIXED_PARTITION_SIZE(label),                                               \
+		.user_data = FIXED_PARTITION_ID(label),                                            \
+	}
+#endif /* CONFIG_FLASH_MAP */
+
+/**
+ * @brief Define an asset storage on a memory-mapped (XIP) region.
+ *
+ * Assets in memory-mapped flash can also be used directly. Going through the
+ * cache helps when reads from the region are slow, since rows are then copied
+ * in bursts instead of read pixel by pixel.
+ *
+ * @param name Name of the storage variable
+ * @param base Address of the region
+ * @param len  Size of the region in bytes
+ */
+#define MU_ASSET_STORAGE_XIP(name, base, len)                                                      \
+	const struct mu_AssetStorage name = {                                                      \
+		.read = mu_asset_xip_read,                                                         \
+		.size = (len),                                                                     \
+		.user_data = (uintptr_t)(base),                                                    \
+	}
+
+/**
+ * @brief Get asset data through the cache.
+ *
+ * Returns cached data if the range is cached, otherwise reads a whole cache
+ * line starting at offset, replacing the least recently used one. The data
+ * stays valid until the next call. Only use from the render thread.
+ *
+ * @param storage Storage to read from
+ * @param offset  Offset of the data in the storage
+ * @param len     Number of bytes needed, at most CONFIG_MICROUI_ASSET_CACHE_LINE_SIZE
+ *
+ * @return Pointer to the data, or NULL if it could not be read
+ */
+const uint8_t *mu_asset_fetch(const struct mu_AssetStorage *storage, uint32_t offset, size_t len);
+
+/**
+ * @brief Drop all cached asset data, e.g. after the storage was rewritten.
+ */
+void mu_asset_cache_invalidate(void);
+
+/**
+ * @brief Get the number of cache hits and misses since the last call.
+ *
+ * @param hits   Set to the number of fetches served from the cache
+ * @param misses Set to the number of fetches reading from the storage
+ */
+void mu_asset_cache_counters(uint32_t *hits, uint32_t *misses);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_MODULES_MICROUI_ASSET_H_ */
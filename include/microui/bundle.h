@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file bundle.h
+ * @brief MicroUI Binary Asset Bundle
+ *
+ * A bundle packs fonts and images into one binary generated by
+ * scripts/microui_bundle_gen.py, so themes and translations can be replaced,
+ * e.g. by an OTA update, without relinking the firmware. Its descriptors have
+ * the in-memory layout of struct mu_FontDescriptor and struct
+ * mu_ImageDescriptor, with pointers resolved for the address the bundle is
+ * generated for. Mapped at that address, e.g. in an XIP flash partition, it is
+ * used in place without copying.
+ *
+ * @code
+ * struct mu_AssetBundle theme;
+ *
+ * if (mu_bundle_open(&theme, (const void *)THEME_PARTITION_ADDRESS, THEME_PARTITION_SIZE) == 0) {
+ *     mu_set_font(ctx, mu_bundle_font(&theme, "body"));
+ *     album_art = mu_bundle_image(&theme, "album");
+ * }
+ * @endcode
+ *
+ * Layout, all values little endian:
+ *
+ * - struct mu_BundleHeader
+ * - entry_count times struct mu_BundleEntry
+ * - descriptors, glyph tables, kerning tables, bitmaps and pixel data,
+ *   each aligned to MU_BUNDLE_ALIGN
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_BUNDLE_H_
+#define ZEPHYR_MODULES_MICROUI_BUNDLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <microui/font.h>
+#include <microui/image.h>
+
+/** "MUAB" */
+#define MU_BUNDLE_MAGIC 0x4241554DU
+/** Incremented on incompatible changes of the bundle layout */
+#define MU_BUNDLE_VERSION 1
+/** Alignment of the bundle start and of every blob in it */
+#define MU_BUNDLE_ALIGN 8
+/** Maximum length of an asset name, including the terminating NUL */
+#define MU_BUNDLE_NAME_LEN 24
+
+enum mu_BundleEntryType {
+	MU_BUNDLE_ENTRY_FONT = 1,
+	MU_BUNDLE_ENTRY_IMAGE = 2,
+};
+
+struct mu_BundleHeader {
+	uint32_t magic;
+	uint16_t version;
+	/** sizeof(void *) of the target the bundle was generated for */
+	uint8_t pointer_size;
+	uint8_t reserved;
+	/** Size of the whole bundle in bytes */
+	uint32_t size;
+	/** CRC-32 (IEEE) of everything after the header */
+	uint32_t crc32;
+	/** Address the pointers in the bundle are resolved for */
+	uint64_t base;
+	/** Structure sizes the bundle was generated for, checked against this build */
+	uint16_t font_size;
+	uint16_t glyph_size;
+	/** 0 if generated without kerning tables */
+	uint16_t kerning_size;
+	uint16_t image_size;
+	uint32_t entry_count;
+	uint32_t reserved2;
+};
+
+struct mu_BundleEntry {
+	/** NUL padded asset name */
+	char name[MU_BUNDLE_NAME_LEN];
+	/** enum mu_BundleEntryType */
+	uint32_t type;
+	/** Offset of the font or image descriptor from the bundle start */
+	uint32_t offset;
+};
+
+/**
+ * @brief An opened bundle
+ */
+struct mu_AssetBundle {
+	const struct mu_BundleHeader *header;
+	const struct mu_BundleEntry *entries;
+};
+
+/**
+ * @brief Validate a bundle and open it for lookups.
+ *
+ * Checks the header, the checksum, that the structure layout matches this
+ * build and that every descriptor and the data it points to lies within the
+ * bundle.
+ *
+ * @param bundle Bundle to initialize
+ * @param data   Start of the bundle, aligned to MU_BUNDLE_ALIGN
+ * @param size   Size of the region holding the bundle
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the bundle is malformed or was generated for a different layout
+ * @retval -EBADMSG if the checksum does not match
+ * @retval -EFAULT if the bundle was generated for a different address,
+ *         see mu_bundle_relocate()
+ */
+int mu_bundle_open(struct mu_AssetBundle *bundle, const void *data, size_t size);
+
+/**
+ * @brief Resolve the pointers of a bundle for the address it is stored at.
+ *
+ * For bundles loaded into RAM, e.g. read from a file system. Bundles in
+ * mapped flash should be generated for their address instead.
+ *
+ * @param data Start of the bundle, aligned to MU_BUNDLE_ALIGN and writable
+ * @param size Size of the region holding the bundle
+ *
+ * @return 0 on success, or a negative errno as mu_bundle_open()
+ */
+int mu_bundle_relocate(void *data, size_t size);
+
+/**
+ * @brief Look up a font by name.
+ *
+ * @return The font descriptor within the bundle, or NULL if there is none
+ */
+const struct mu_FontDescriptor *mu_bundle_font(const struct mu_AssetBundle *bundle,
+					       const char *name);
+
+/**
+ * @brief Look up an image by name.
+ *
+ * @return The image descriptor within the bundle, or NULL if there is none
+ */
+const struct mu_ImageDescriptor *mu_bundle_image(const struct mu_AssetBundle *bundle,
+						 const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_MODULES_MICROUI_BUNDLE_H_ */
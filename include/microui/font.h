@@ -13,10 +13,27 @@ extern "C" {
 #include <microui/microui.h>
 #include <stdint.h>
 
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+#include <microui/asset.h>
+#endif
+
+/*
+ * A glyph bitmap only covers the bounding box of the inked pixels. Its rows are
+ * packed without padding, 1 bit per pixel with the most significant bit first.
+ */
 struct mu_FontGlyph {
 	uint32_t codepoint;
+	/* Distance to the pen position of the next glyph */
+	uint8_t advance;
+	/* Size of the bounding box */
 	uint8_t width;
 	uint8_t height;
+	/*
+	 * Position of the bounding box relative to the pen at the top of the line.
+	 * The box lies within the advance, text bounds are the sum of advances.
+	 */
+	int8_t x_offset;
+	int8_t y_offset;
 	const uint8_t *bitmap;
 };
 
@@ -30,8 +47,6 @@ struct mu_FontKerningPair {
 
 struct mu_FontDescriptor {
 	uint32_t height;
-	uint32_t bitmap_width;
-	uint32_t bytes_per_row;
 	uint32_t default_width;
 	uint32_t char_spacing;
 	uint32_t glyph_count;
@@ -40,6 +55,10 @@ struct mu_FontDescriptor {
 	uint32_t kerning_count;
 	const struct mu_FontKerningPair *kerning_pairs;
 #endif
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	/* If set, glyph bitmaps are offsets into this storage */
+	const struct mu_AssetStorage *storage;
+#endif
 };
 
 static inline void mu_set_font(mu_Context *ctx, const struct mu_FontDescriptor *font)
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file gesture.h
+ * @brief MicroUI Touch Gesture Recognition
+ *
+ * Recognizes swipes, flings, long presses and pinches from the touch input
+ * device. Recognition runs in the input callback on the timestamps of the
+ * input events, independent of the frame rate. Recognized gestures are queued
+ * and can be fetched from the frame callback with mu_gesture_get().
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_GESTURE_H_
+#define ZEPHYR_MODULES_MICROUI_GESTURE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <microui/microui.h>
+
+/**
+ * @brief Gesture types
+ */
+enum mu_gesture_type {
+	MU_GESTURE_SWIPE = 0,  /**< Touch moved and released slowly */
+	MU_GESTURE_FLING,      /**< Touch released while moving fast */
+	MU_GESTURE_LONG_PRESS, /**< Touch held in place */
+	MU_GESTURE_PINCH,      /**< Distance between two touches changed */
+};
+
+/**
+ * @brief Dominant direction of a swipe or fling
+ */
+enum mu_gesture_direction {
+	MU_GESTURE_LEFT = 0, /**< Towards smaller x */
+	MU_GESTURE_RIGHT,    /**< Towards larger x */
+	MU_GESTURE_UP,       /**< Towards smaller y */
+	MU_GESTURE_DOWN,     /**< Towards larger y */
+};
+
+/**
+ * @brief A recognized gesture
+ */
+struct mu_Gesture {
+	/** Type of the gesture */
+	enum mu_gesture_type type;
+	/** Dominant direction, valid for swipes and flings */
+	enum mu_gesture_direction direction;
+	/** Touch down position, or the center between both touches for pinches */
+	mu_Vec2 pos;
+	/** Movement from the touch down position, valid for swipes and flings */
+	mu_Vec2 delta;
+	/** Horizontal velocity at release in pixels per second */
+	mu_Real velocity_x;
+	/** Vertical velocity at release in pixels per second */
+	mu_Real velocity_y;
+	/** Distance between both touches relative to the start, valid for pinches */
+	mu_Real scale;
+	/** Cycle count (k_cycle_get_32()) of the input event completing the gesture */
+	uint32_t timestamp;
+};
+
+/**
+ * @brief Fetch the next recognized gesture.
+ *
+ * Gestures are returned in the order they were recognized. Call this from the
+ * frame callback until it returns false.
+ *
+ * @param gesture Filled with the next gesture.
+ *
+ * @return true if a gesture was returned, false if none is pending.
+ *
+ * @code
+ * struct mu_Gesture gesture;
+ *
+ * while (mu_gesture_get(&gesture)) {
+ *     if (gesture.type == MU_GESTURE_SWIPE && gesture.direction == MU_GESTURE_LEFT) {
+ *         next_page();
+ *     }
+ * }
+ * @endcode
+ */
+bool mu_gesture_get(struct mu_Gesture *gesture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_MODULES_MICROUI_GESTURE_H_ */
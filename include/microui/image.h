@@ -14,6 +14,10 @@ extern "C" {
 #include <zephyr/drivers/display.h>
 #include <microui/microui.h>
 
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+#include <microui/asset.h>
+#endif
+
 enum mu_ImageDataCompression {
     MU_IMAGE_COMPRESSION_NONE = 0,
 };
@@ -26,6 +30,10 @@ struct mu_ImageDescriptor {
     const uint8_t *data;
     enum display_pixel_format pixel_format;
     enum mu_ImageDataCompression compression;
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+    /* If set, data is an offset into this storage */
+    const struct mu_AssetStorage *storage;
+#endif
 };
 
 static inline void mu_get_img_dimensions(mu_Image image, int* width, int* height)
@@ -23,6 +23,10 @@
 #if defined(CONFIG_MICROUI_ANIMATIONS) || defined(__DOXYGEN__)
 #define MU_ANIM_POOL_SIZE       CONFIG_MICROUI_ANIMATION_POOL_SIZE
 #endif
+#if defined(CONFIG_MICROUI_TEXT_WRAP_CACHE) || defined(__DOXYGEN__)
+#define MU_TEXTWRAP_SIZE        CONFIG_MICROUI_TEXT_WRAP_CACHE_SIZE
+#define MU_TEXTWRAP_LINES       CONFIG_MICROUI_TEXT_WRAP_CACHE_LINES
+#endif
 #define MU_MAX_WIDTHS           CONFIG_MICROUI_MAX_WIDTHS
 #define MU_REAL                 float
 #define MU_REAL_FMT             "%.3g"
@@ -141,14 +145,14 @@ typedef struct { int type, size; } mu_BaseCommand;
 typedef struct { mu_BaseCommand base; void *dst; } mu_JumpCommand;
 typedef struct { mu_BaseCommand base; mu_Rect rect; } mu_ClipCommand;
 typedef struct { mu_BaseCommand base; mu_Rect rect; mu_Color color; } mu_RectCommand;
-typedef struct { mu_BaseCommand base; mu_Font font; mu_Vec2 pos; mu_Color color; char str[1]; } mu_TextCommand;
-typedef struct { mu_BaseCommand base; mu_Rect rect; int id; mu_Color color; } mu_IconCommand;
+typedef struct { mu_BaseCommand base; mu_Font font; mu_Vec2 pos; mu_Color color; int clipped; char str[1]; } mu_TextCommand;
+typedef struct { mu_BaseCommand base; mu_Rect rect; int id; mu_Color color; int clipped; } mu_IconCommand;
 #if defined(CONFIG_MICROUI_DRAW_EXTENSIONS) || defined(__DOXYGEN__)
-typedef struct { mu_BaseCommand base; mu_Vec2 center; int radius; mu_Color color; } mu_CircleCommand;
-typedef struct { mu_BaseCommand base; mu_Vec2 center; int radius; int thickness; mu_Real start_angle; mu_Real end_angle; mu_Color color; } mu_ArcCommand;
-typedef struct { mu_BaseCommand base; mu_Vec2 p0, p1; int thickness; mu_Color color; } mu_LineCommand;
-typedef struct { mu_BaseCommand base; mu_Vec2 pos; mu_Image image; } mu_ImageCommand;
-typedef struct { mu_BaseCommand base; mu_Vec2 p0, p1, p2; mu_Color color; } mu_TriangleCommand;
+typedef struct { mu_BaseCommand base; mu_Vec2 center; int radius; mu_Color color; int clipped; } mu_CircleCommand;
+typedef struct { mu_BaseCommand base; mu_Vec2 center; int radius; int thickness; mu_Real start_angle; mu_Real end_angle; mu_Color color; int clipped; } mu_ArcCommand;
+typedef struct { mu_BaseCommand base; mu_Vec2 p0, p1; int thickness; mu_Color color; int clipped; } mu_LineCommand;
+typedef struct { mu_BaseCommand base; mu_Vec2 pos; mu_Image image; int clipped; } mu_ImageCommand;
+typedef struct { mu_BaseCommand base; mu_Vec2 p0, p1, p2; mu_Color color; int clipped; } mu_TriangleCommand;
 #endif
 
 typedef union {
@@ -175,11 +179,16 @@ typedef struct {
   mu_Vec2 size;
   mu_Vec2 max;
   int widths[MU_MAX_WIDTHS];
+  int flex_total;
+  int flex_fixed;
   int items;
   int item_index;
   int next_row;
   int next_type;
   int indent;
+  int list_index;
+  int list_end;
+  int list_row_height;
 } mu_Layout;
 
 typedef struct {
@@ -190,8 +199,24 @@ typedef struct {
   mu_Vec2 scroll;
   int zindex;
   int open;
+  int opaque;
+  mu_Rect frame_rect; /* covered by the frame if opaque, before moves and resizes */
+#if defined(CONFIG_MICROUI_KINETIC_SCROLL) || defined(__DOXYGEN__)
+  mu_Real kinetic_x, kinetic_y;   /* sub-pixel scroll position while in motion */
+  mu_Real velocity_x, velocity_y; /* pixels per second */
+  uint32_t kinetic_time_ms;
+  int kinetic;
+#endif
 } mu_Container;
 
+#if defined(CONFIG_MICROUI_TEXT_WRAP_CACHE) || defined(__DOXYGEN__)
+typedef struct {
+  int text_len; /* checked on a hit, so lines never exceed the text */
+  int line_count;
+  struct { uint16_t start, len; } lines[MU_TEXTWRAP_LINES];
+} mu_TextWrap;
+#endif
+
 typedef struct {
   mu_Font font;
   mu_Vec2 size;
@@ -216,14 +241,24 @@ typedef mu_Real (*mu_EasingFunc)(mu_Real t);
  * Stores the cached state for a single animation, identified by ID.
  */
 typedef struct {
-  mu_Real current;         /**< Current animated value */
-  mu_Real start;           /**< Start value */
-  mu_Real end;             /**< End value */
+  union {
+    mu_Real current;       /**< Current animated value */
+    int32_t current_q16;   /**< Current value of a fixed-point animation */
+  };
+  union {
+    mu_Real start;         /**< Start value */
+    int32_t start_q16;     /**< Start value of a fixed-point animation */
+  };
+  union {
+    mu_Real end;           /**< End value */
+    int32_t end_q16;       /**< End value of a fixed-point animation */
+  };
   uint32_t start_time_ms;  /**< Start time */
   uint32_t duration_ms;    /**< Duration */
   mu_EasingFunc easing;    /**< Easing function pointer */
   uint8_t finished : 1;    /**< Whether animation has completed */
   uint8_t loop : 1;        /**< Whether animation should loop */
+  uint8_t fixed : 1;       /**< Whether the values are fixed-point */
 } mu_AnimState;
 #endif
 
@@ -247,6 +282,10 @@ struct mu_Context {
   mu_Container *hover_root;
   mu_Container *next_hover_root;
   mu_Container *scroll_target;
+#if defined(CONFIG_MICROUI_KINETIC_SCROLL) || defined(__DOXYGEN__)
+  mu_Container *kinetic_target;
+  int kinetic_active;
+#endif
   char number_edit_buf[MU_MAX_FMT];
   mu_Id number_edit;
   /* stacks */
@@ -260,9 +299,14 @@ struct mu_Context {
   mu_PoolItem container_pool[MU_CONTAINERPOOL_SIZE];
   mu_Container containers[MU_CONTAINERPOOL_SIZE];
   mu_PoolItem treenode_pool[MU_TREENODEPOOL_SIZE];
+#if defined(CONFIG_MICROUI_TEXT_WRAP_CACHE) || defined(__DOXYGEN__)
+  mu_PoolItem textwrap_pool[MU_TEXTWRAP_SIZE];
+  mu_TextWrap textwraps[MU_TEXTWRAP_SIZE];
+#endif
 #if defined(CONFIG_MICROUI_ANIMATIONS) || defined(__DOXYGEN__)
   mu_PoolItem anim_pool[MU_ANIM_POOL_SIZE];
   mu_AnimState anim_states[MU_ANIM_POOL_SIZE];
+  int anim_active_frame;
 #endif
   uint32_t curr_time_ms;
   /* input state */
@@ -296,6 +340,23 @@ int mu_check_clip(mu_Context *ctx, mu_Rect r);
 mu_Container* mu_get_current_container(mu_Context *ctx);
 mu_Container* mu_get_container(mu_Context *ctx, const char *name);
 void mu_bring_to_front(mu_Context *ctx, mu_Container *cnt);
+#if defined(CONFIG_MICROUI_KINETIC_SCROLL) || defined(__DOXYGEN__)
+/**
+ * @brief Start a kinetic scroll of a container.
+ *
+ * The container keeps scrolling with the given velocity, slowed down by
+ * friction and bouncing back from its edges, like after a released drag.
+ * Velocities are in pixels per second of scroll position: positive values
+ * scroll towards the end of the content, so the content moves left or up.
+ * To continue a fling gesture, pass its velocities negated.
+ *
+ * @param ctx MicroUI context
+ * @param cnt Container to scroll
+ * @param velocity_x Horizontal velocity in pixels per second
+ * @param velocity_y Vertical velocity in pixels per second
+ */
+void mu_scroll_fling(mu_Context *ctx, mu_Container *cnt, mu_Real velocity_x, mu_Real velocity_y);
+#endif
 
 int mu_pool_init(mu_Context *ctx, mu_PoolItem *items, int len, mu_Id id);
 int mu_pool_get(mu_Context *ctx, mu_PoolItem *items, int len, mu_Id id);
@@ -311,6 +372,7 @@ void mu_input_text(mu_Context *ctx, const char *text);
 
 mu_Command* mu_push_command(mu_Context *ctx, int type, int size);
 int mu_next_command(mu_Context *ctx, mu_Command **cmd);
+mu_Rect mu_command_rect(mu_Context *ctx, mu_Command *cmd);
 void mu_set_clip(mu_Context *ctx, mu_Rect rect);
 void mu_draw_rect(mu_Context *ctx, mu_Rect rect, mu_Color color);
 void mu_draw_box(mu_Context *ctx, mu_Rect rect, mu_Color color);
@@ -345,6 +407,7 @@ void mu_update_control(mu_Context *ctx, mu_Id id, mu_Rect rect, int opt);
 #define mu_begin_treenode(ctx, label)     mu_begin_treenode_ex(ctx, label, 0)
 #define mu_begin_window(ctx, title, rect) mu_begin_window_ex(ctx, title, rect, 0)
 #define mu_begin_panel(ctx, name)         mu_begin_panel_ex(ctx, name, 0)
+#define mu_begin_list(ctx, name, rows, h) mu_begin_list_ex(ctx, name, rows, h, 0)
 
 void mu_text(mu_Context *ctx, const char *text);
 void mu_label(mu_Context *ctx, const char *text);
@@ -364,5 +427,8 @@ int mu_begin_popup(mu_Context *ctx, const char *name);
 void mu_end_popup(mu_Context *ctx);
 void mu_begin_panel_ex(mu_Context *ctx, const char *name, int opt);
 void mu_end_panel(mu_Context *ctx);
+void mu_begin_list_ex(mu_Context *ctx, const char *name, int row_count, int row_height, int opt);
+int mu_list_row(mu_Context *ctx, int *index);
+void mu_end_list(mu_Context *ctx);
 
 #endif
@@ -114,6 +114,77 @@ int mu_event_loop_start(void);
  */
 int mu_event_loop_stop(void);
 
+/**
+ * @brief Request that the event loop runs another frame.
+ *
+ * Wakes the event loop if it went idle. While a frame is running or
+ * scheduled, the loop does not go idle after it, but the next frame still
+ * starts at its regular deadline. Has no effect when the event loop is not
+ * running. Safe to call from any thread.
+ *
+ * @note With CONFIG_MICROUI_EVENT_LOOP_TICKLESS the loop sleeps once a frame
+ *       produced no change, so state the UI depends on that changes outside of
+ *       MicroUI (time, sensor values, ...) must be followed by this call.
+ */
+void mu_request_frame(void);
+
+/**
+ * @brief Run a frame immediately, ahead of the frame pacing.
+ *
+ * Unlike mu_request_frame(), this also starts a frame when one is already
+ * scheduled for a later deadline. The regular deadlines are not shifted.
+ * Safe to call from any thread.
+ */
+void mu_request_frame_immediate(void);
+
+/**
+ * @brief Get the number of frames missed by the event loop.
+ *
+ * A frame is missed when processing the previous one overran its refresh
+ * period, so the event loop skipped ahead to the next period.
+ *
+ * @return uint32_t Number of missed frames since the loop was started.
+ */
+uint32_t mu_get_missed_frames(void);
+
+#if defined(CONFIG_MICROUI_FRAME_GOVERNOR) || defined(__DOXYGEN__)
+/**
+ * @brief Frame timing statistics of the event loop.
+ */
+struct mu_FrameStats {
+	/** Moving average of the frame callback duration in microseconds */
+	uint32_t update_us;
+	/** Moving average of the redraw check and rendering duration in microseconds */
+	uint32_t render_us;
+	/** Moving average of the display write duration in microseconds */
+	uint32_t present_us;
+	/** Frame period currently targeted by the governor in microseconds */
+	uint32_t target_period_us;
+	/** Divisor applied to the display refresh rate, 1 to 4 */
+	uint32_t rate_divisor;
+	/** Number of missed frames since the loop was started */
+	uint32_t missed_frames;
+};
+
+/**
+ * @brief Get the frame timing statistics of the event loop.
+ *
+ * @param stats Filled with the current statistics.
+ */
+void mu_get_frame_stats(struct mu_FrameStats *stats);
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+
+#if defined(CONFIG_MICROUI_FRAME_PACING_SYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Signal a display sync event to the event loop.
+ *
+ * Starts the next frame if at least three quarters of the display refresh
+ * period have passed since the previous one. Meant to be called from a
+ * tearing effect or vsync interrupt. Safe to call from ISR context.
+ */
+void mu_frame_sync_signal(void);
+#endif /* CONFIG_MICROUI_FRAME_PACING_SYNC */
+
 #endif /* CONFIG_MICROUI_EVENT_LOOP */
 
 #if defined(CONFIG_MICROUI_INPUT) || defined(__DOXYGEN__)
@@ -133,8 +204,106 @@ int mu_event_loop_stop(void);
  */
 bool mu_handle_input_events(void);
 
+#if defined(CONFIG_MICROUI_INPUT_LATENCY) || defined(__DOXYGEN__)
+
+/** Number of buckets of the input latency histogram */
+#define MU_INPUT_LATENCY_BUCKETS 10
+
+/**
+ * @brief Input-to-display latency histogram.
+ *
+ * Bucket 0 counts frames with a latency below 1 ms, bucket i counts latencies
+ * from 2^(i-1) ms up to 2^i ms. The last bucket also counts everything above.
+ */
+struct mu_InputLatency {
+	/** Number of frames per latency range */
+	uint32_t buckets[MU_INPUT_LATENCY_BUCKETS];
+	/** Total number of frames measured */
+	uint32_t count;
+	/** Largest latency measured in microseconds */
+	uint32_t max_us;
+	/** Sum of all latencies measured in microseconds */
+	uint64_t total_us;
+};
+
+/**
+ * @brief Get the input-to-display latency histogram.
+ *
+ * @param result Filled with the latencies measured since the last reset.
+ */
+void mu_get_input_latency(struct mu_InputLatency *result);
+
+/**
+ * @brief Clear the input-to-display latency histogram.
+ */
+void mu_reset_input_latency(void);
+
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
+
 #endif /* CONFIG_MICROUI_INPUT */
 
+#if defined(CONFIG_MICROUI_RENDER_BANDS) || defined(__DOXYGEN__)
+/**
+ * @brief Set the number of bands the display is split into for rendering.
+ *
+ * Band 0 is drawn by the thread calling mu_render(), every other band by a
+ * band thread. Fewer bands leave CPUs to other work. Takes effect on the next
+ * frame.
+ *
+ * @param count Number of bands, 1 to CONFIG_MICROUI_RENDER_BAND_THREADS + 1
+ *
+ * @return 0 on success, -EINVAL if count is out of range.
+ */
+int mu_set_render_bands(int count);
+#endif /* CONFIG_MICROUI_RENDER_BANDS */
+
+#if defined(CONFIG_MICROUI_RENDER_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Rendering statistics of one command type.
+ */
+struct mu_CommandStats {
+	/** Commands drawn */
+	uint32_t count;
+	/** Pixels written by the CPU */
+	uint32_t pixels;
+	/** Pixels alpha blended with the frame buffer, included in pixels */
+	uint32_t blended;
+	/** Cycles spent drawing the commands */
+	uint32_t cycles;
+};
+
+/**
+ * @brief Rendering statistics of a frame.
+ *
+ * Cycles are measured with k_cycle_get_32(). With band rendering, the
+ * drawing and clearing cycles of all band threads are summed up, and a
+ * command spanning several bands is counted once per band.
+ */
+struct mu_RenderStats {
+	/** Statistics per command type, indexed by MU_COMMAND_* */
+	struct mu_CommandStats commands[MU_COMMAND_MAX];
+	/** Cycles spent clearing the frame buffer */
+	uint32_t clear_cycles;
+	/** Cycles spent writing the frame to the display */
+	uint32_t present_cycles;
+	/** Cycles of the whole mu_render() call */
+	uint32_t render_cycles;
+	/** Text width cache lookups since the previous frame */
+	uint32_t text_width_hits;
+	uint32_t text_width_misses;
+	/** Asset cache lookups while rendering the frame */
+	uint32_t asset_cache_hits;
+	uint32_t asset_cache_misses;
+};
+
+/**
+ * @brief Get the statistics of the last rendered frame.
+ *
+ * @param stats Filled with the statistics.
+ */
+void mu_get_render_stats(struct mu_RenderStats *stats);
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+
 /**
  * @brief Set the background color for MicroUI.
  *
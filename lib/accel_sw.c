@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file accel_sw.c
+ * @brief Software reference implementation of the 2D accelerator interface
+ */
+
+#include <microui/accel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+static int sw_fill(const struct mu_Accel *accel, const struct mu_AccelSurface *dst, mu_Rect rect,
+		   uint32_t pixel)
+{
+	int bpp = DISPLAY_BITS_PER_PIXEL(dst->format) / 8;
+	uint8_t *row = dst->buf + rect.y * dst->stride + rect.x * bpp;
+
+	ARG_UNUSED(accel);
+
+	if (bpp == 0) {
+		return -ENOTSUP;
+	}
+
+	/* Store the first row like the software renderer, then replicate it */
+	for (int x = 0; x < rect.w; x++) {
+		uint8_t *p = row + x * bpp;
+
+		switch (bpp) {
+		case 1:
+			*p = pixel;
+			break;
+		case 2:
+			*(uint16_t *)p = pixel;
+			break;
+		case 3:
+			sys_put_be24(pixel, p);
+			break;
+		default:
+			*(uint32_t *)p = pixel;
+			break;
+		}
+	}
+
+	for (int y = 1; y < rect.h; y++) {
+		memcpy(row + y * dst->stride, row, rect.w * bpp);
+	}
+
+	return 0;
+}
+
+static int sw_blit(const struct mu_Accel *accel, const struct mu_AccelSurface *dst, mu_Vec2 pos,
+		   const struct mu_ImageDescriptor *src, mu_Rect src_rect)
+{
+	int bpp = DISPLAY_BITS_PER_PIXEL(dst->format) / 8;
+
+	ARG_UNUSED(accel);
+
+	if (bpp == 0 || src->pixel_format != dst->format) {
+		return -ENOTSUP;
+	}
+
+	for (int y = 0; y < src_rect.h; y++) {
+		memcpy(dst->buf + (pos.y + y) * dst->stride + pos.x * bpp,
+		       src->data + (src_rect.y + y) * src->stride + src_rect.x * bpp,
+		       src_rect.w * bpp);
+	}
+
+	return 0;
+}
+
+static int sw_wait(const struct mu_Accel *accel)
+{
+	ARG_UNUSED(accel);
+
+	/* Operations complete before they return */
+	return 0;
+}
+
+const struct mu_Accel mu_accel_sw = {
+	.fill = sw_fill,
+	.blit = sw_blit,
+	.wait = sw_wait,
+};
@@ -146,6 +146,159 @@ static const mu_EasingFunc easing_funcs[] = {
 
 BUILD_ASSERT(ARRAY_SIZE(easing_funcs) == MU_EASE_MAX, "Easing function lookup array size mismatch");
 
+#ifdef CONFIG_MICROUI_ANIMATION_Q16
+/*
+ * Fixed-point easing functions
+ *
+ * Curves built from sines or exponentials are sampled as
+ * round(f(i / N) * 65536) and interpolated linearly. N is chosen per curve to
+ * keep the interpolation error below 1/256. Polynomial curves are evaluated
+ * directly.
+ */
+
+#define EASE_LUT_SHIFT    5
+#define ELASTIC_LUT_SHIFT 7
+
+static const mu_q16 ease_in_lut[] = {
+	0, 79, 316, 709, 1259, 1964, 2822, 3831,
+	4989, 6292, 7738, 9324, 11045, 12897, 14876, 16977,
+	19195, 21525, 23960, 26496, 29126, 31844, 34643, 37516,
+	40456, 43458, 46512, 49612, 52751, 55920, 59112, 62320,
+	65536,
+};
+
+static const mu_q16 ease_out_lut[] = {
+	0, 3216, 6424, 9616, 12785, 15924, 19024, 22078,
+	25080, 28020, 30893, 33692, 36410, 39040, 41576, 44011,
+	46341, 48559, 50660, 52639, 54491, 56212, 57798, 59244,
+	60547, 61705, 62714, 63572, 64277, 64827, 65220, 65457,
+	65536,
+};
+
+static const mu_q16 ease_in_out_lut[] = {
+	0, 158, 630, 1411, 2494, 3869, 5522, 7438,
+	9598, 11980, 14563, 17321, 20228, 23256, 26375, 29556,
+	32768, 35980, 39161, 42280, 45308, 48215, 50973, 53556,
+	55938, 58098, 60014, 61667, 63042, 64125, 64906, 65378,
+	65536,
+};
+
+static const mu_q16 ease_out_elastic_lut[] = {
+	0, 4284, 9848, 16405, 23669, 31363, 39227, 47022,
+	54538, 61590, 68030, 73739, 78631, 82653, 85782, 88021,
+	89399, 89965, 89787, 88946, 87534, 85649, 83393, 80867,
+	78170, 75394, 72627, 69945, 67414, 65090, 63017, 61228,
+	59743, 58574, 57720, 57173, 56917, 56930, 57183, 57644,
+	58280, 59054, 59931, 60875, 61854, 62835, 63791, 64698,
+	65536, 66288, 66941, 67488, 67924, 68248, 68463, 68573,
+	68587, 68514, 68364, 68151, 67886, 67582, 67252, 66908,
+	66560, 66219, 65895, 65593, 65321, 65083, 64881, 64719,
+	64597, 64513, 64467, 64456, 64476, 64524, 64595, 64685,
+	64790, 64905, 65027, 65149, 65271, 65387, 65495, 65594,
+	65681, 65754, 65814, 65860, 65893, 65912, 65918, 65913,
+	65898, 65874, 65844, 65807, 65767, 65725, 65681, 65638,
+	65597, 65558, 65522, 65491, 65464, 65441, 65424, 65412,
+	65404, 65401, 65402, 65407, 65414, 65425, 65437, 65451,
+	65466, 65482, 65497, 65512, 65526, 65538, 65550, 65560,
+	65536,
+};
+
+/* Back easing overshoot, 1.70158 */
+#define EASE_BACK_S 111515
+
+/* Bounce parabola factor, 7.5625 */
+#define EASE_BOUNCE_K 495616
+
+static inline mu_q16 q16_mul(mu_q16 a, mu_q16 b)
+{
+	return (mu_q16)(((int64_t)a * b) >> 16);
+}
+
+static mu_q16 ease_lut(const mu_q16 *lut, unsigned int shift, mu_q16 t)
+{
+	unsigned int step = 16 - shift;
+	unsigned int idx = MIN((uint32_t)t >> step, BIT(shift) - 1);
+	mu_q16 frac = t - (mu_q16)(idx << step);
+
+	return lut[idx] + (((lut[idx + 1] - lut[idx]) * frac) >> step);
+}
+
+static mu_q16 ease_bounce_q16(mu_q16 t)
+{
+	/* Breakpoints at 4/11, 8/11 and 10/11 of the duration */
+	if (11 * t < 4 * MU_Q16_ONE) {
+		return q16_mul(EASE_BOUNCE_K, q16_mul(t, t));
+	} else if (11 * t < 8 * MU_Q16_ONE) {
+		t -= 6 * MU_Q16_ONE / 11;
+		return q16_mul(EASE_BOUNCE_K, q16_mul(t, t)) + MU_Q16_ONE * 3 / 4;
+	} else if (11 * t < 10 * MU_Q16_ONE) {
+		t -= 9 * MU_Q16_ONE / 11;
+		return q16_mul(EASE_BOUNCE_K, q16_mul(t, t)) + MU_Q16_ONE * 15 / 16;
+	}
+	t -= 21 * MU_Q16_ONE / 22;
+	return q16_mul(EASE_BOUNCE_K, q16_mul(t, t)) + MU_Q16_ONE * 63 / 64;
+}
+
+mu_q16 mu_ease_q16(enum mu_easing easing, mu_q16 t)
+{
+	mu_q16 f;
+
+	t = CLAMP(t, 0, MU_Q16_ONE);
+
+	switch (easing) {
+	case MU_EASE_IN:
+		return ease_lut(ease_in_lut, EASE_LUT_SHIFT, t);
+	case MU_EASE_OUT:
+		return ease_lut(ease_out_lut, EASE_LUT_SHIFT, t);
+	case MU_EASE_IN_OUT:
+		return ease_lut(ease_in_out_lut, EASE_LUT_SHIFT, t);
+	case MU_EASE_IN_QUAD:
+		return q16_mul(t, t);
+	case MU_EASE_OUT_QUAD:
+		return q16_mul(t, 2 * MU_Q16_ONE - t);
+	case MU_EASE_IN_OUT_QUAD:
+		if (t < MU_Q16_ONE / 2) {
+			return 2 * q16_mul(t, t);
+		}
+		return q16_mul(4 * MU_Q16_ONE - 2 * t, t) - MU_Q16_ONE;
+	case MU_EASE_IN_CUBIC:
+		return q16_mul(q16_mul(t, t), t);
+	case MU_EASE_OUT_CUBIC:
+		f = t - MU_Q16_ONE;
+		return q16_mul(q16_mul(f, f), f) + MU_Q16_ONE;
+	case MU_EASE_IN_OUT_CUBIC:
+		if (t < MU_Q16_ONE / 2) {
+			return 4 * q16_mul(q16_mul(t, t), t);
+		}
+		f = 2 * t - 2 * MU_Q16_ONE;
+		return q16_mul(q16_mul(f, f), f) / 2 + MU_Q16_ONE;
+	case MU_EASE_OUT_ELASTIC:
+		return ease_lut(ease_out_elastic_lut, ELASTIC_LUT_SHIFT, t);
+	case MU_EASE_OUT_BOUNCE:
+		return ease_bounce_q16(t);
+	case MU_EASE_IN_BACK:
+		return q16_mul(q16_mul(t, t), q16_mul(EASE_BACK_S + MU_Q16_ONE, t) - EASE_BACK_S);
+	case MU_EASE_OUT_BACK:
+		f = t - MU_Q16_ONE;
+		return q16_mul(q16_mul(f, f), q16_mul(EASE_BACK_S + MU_Q16_ONE, f) + EASE_BACK_S) +
+		       MU_Q16_ONE;
+	default:
+		return t;
+	}
+}
+#endif /* CONFIG_MICROUI_ANIMATION_Q16 */
+
+/*
+ * Record that an animation evaluated in this frame still needs frames, so the
+ * event loop can tell without scanning the pool.
+ */
+static void track_active(mu_Context *ctx, const mu_AnimState *state)
+{
+	if (!state->finished) {
+		ctx->anim_active_frame = ctx->frame;
+	}
+}
+
 mu_AnimId mu_anim_id(const char *name)
 {
 	mu_AnimId hash = 2166136261u;
@@ -214,8 +367,9 @@ mu_Real mu_anim_ex(mu_Context *ctx, mu_AnimId id, mu_Real start, mu_Real end, ui
 	}
 
 	/* Initialize if this is a new animation or parameters changed */
-	if (state->duration_ms != duration_ms || state->start != start || state->end != end ||
-	    state->easing != easing || state->loop != loop) {
+	if (state->fixed || state->duration_ms != duration_ms || state->start != start ||
+	    state->end != end || state->easing != easing || state->loop != loop) {
+		state->fixed = 0;
 		state->start = start;
 		state->end = end;
 		state->duration_ms = duration_ms;
@@ -247,6 +401,8 @@ mu_Real mu_anim_ex(mu_Context *ctx, mu_AnimId id, mu_Real start, mu_Real end, ui
 		}
 	}
 
+	track_active(ctx, state);
+
 	return state->current;
 }
 
@@ -258,6 +414,69 @@ mu_Real mu_anim(mu_Context *ctx, mu_AnimId id, mu_Real start, mu_Real end, uint3
 	return mu_anim_ex(ctx, id, start, end, duration_ms, func, loop);
 }
 
+#ifdef CONFIG_MICROUI_ANIMATION_Q16
+mu_q16 mu_anim_q16(mu_Context *ctx, mu_AnimId id, mu_q16 start, mu_q16 end, uint32_t duration_ms,
+		   enum mu_easing easing, bool loop)
+{
+	mu_AnimState *state = get_anim_state(ctx, id, true);
+
+	if (!state) {
+		return end;
+	}
+
+	if (easing >= MU_EASE_MAX) {
+		easing = MU_EASE_LINEAR;
+	}
+
+	/* The float easing function identifies the curve, like for mu_anim() */
+	mu_EasingFunc func = easing_funcs[easing];
+
+	if (!state->fixed || state->duration_ms != duration_ms || state->start_q16 != start ||
+	    state->end_q16 != end || state->easing != func || state->loop != loop) {
+		state->fixed = 1;
+		state->start_q16 = start;
+		state->end_q16 = end;
+		state->duration_ms = duration_ms;
+		state->start_time_ms = ctx->curr_time_ms;
+		state->easing = func;
+		state->finished = 0;
+		state->current_q16 = start;
+		state->loop = loop ? 1 : 0;
+	}
+
+	uint32_t elapsed = ctx->curr_time_ms - state->start_time_ms;
+	mu_q16 t = MU_Q16_ONE;
+
+	if (elapsed < duration_ms) {
+		uint32_t duration = duration_ms;
+
+		/* Keep elapsed << 16 within 32 bits */
+		while (duration > UINT16_MAX) {
+			duration >>= 1;
+			elapsed >>= 1;
+		}
+		t = (mu_q16)((elapsed << 16) / duration);
+	}
+
+	mu_q16 eased = mu_ease_q16(easing, t);
+
+	state->current_q16 = start + (mu_q16)((((int64_t)end - start) * eased) >> 16);
+
+	/* Reset loop AFTER calculating the value, so we return end value first */
+	if (t >= MU_Q16_ONE) {
+		if (state->loop) {
+			state->start_time_ms = ctx->curr_time_ms;
+		} else {
+			state->finished = 1;
+		}
+	}
+
+	track_active(ctx, state);
+
+	return state->current_q16;
+}
+#endif /* CONFIG_MICROUI_ANIMATION_Q16 */
+
 bool mu_anim_done(mu_Context *ctx, mu_AnimId id)
 {
 	mu_AnimState *state = get_anim_state(ctx, id, false);
@@ -276,7 +495,11 @@ void mu_anim_reset(mu_Context *ctx, mu_AnimId id)
 	if (state) {
 		state->start_time_ms = ctx->curr_time_ms;
 		state->finished = 0;
-		state->current = state->start;
+		if (state->fixed) {
+			state->current_q16 = state->start_q16;
+		} else {
+			state->current = state->start;
+		}
 	}
 }
 
@@ -302,3 +525,14 @@ int mu_anim_count(mu_Context *ctx)
 	}
 	return count;
 }
+
+bool mu_anim_active(mu_Context *ctx)
+{
+#ifdef CONFIG_MICROUI_KINETIC_SCROLL
+	if (ctx->kinetic_active) {
+		return true;
+	}
+#endif /* CONFIG_MICROUI_KINETIC_SCROLL */
+
+	return ctx->anim_active_frame == ctx->frame;
+}
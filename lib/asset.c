@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file asset.c
+ * @brief Read-ahead cache for assets in external storage
+ */
+
+#include <microui/asset.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(microui_asset, LOG_LEVEL_INF);
+
+struct asset_cache_line {
+	const struct mu_AssetStorage *storage;
+	uint32_t offset;
+	uint32_t len;
+	uint32_t last_use;
+	uint8_t data[CONFIG_MICROUI_ASSET_CACHE_LINE_SIZE] __aligned(4);
+};
+
+static struct asset_cache_line cache[CONFIG_MICROUI_ASSET_CACHE_LINES];
+static uint32_t use_counter;
+static uint32_t cache_hits;
+static uint32_t cache_misses;
+static bool range_error_logged;
+
+const uint8_t *mu_asset_fetch(const struct mu_AssetStorage *storage, uint32_t offset, size_t len)
+{
+	struct asset_cache_line *victim = &cache[0];
+
+	if (len > CONFIG_MICROUI_ASSET_CACHE_LINE_SIZE || offset > storage->size ||
+	    len > storage->size - offset) {
+		/* The same range is requested again every frame, report it once */
+		if (!range_error_logged) {
+			LOG_ERR("Asset range %u+%zu does not fit the cache or storage", offset, len);
+			range_error_logged = true;
+		}
+		return NULL;
+	}
+
+	use_counter++;
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct asset_cache_line *line = &cache[i];
+
+		if (line->storage == storage && offset >= line->offset &&
+		    offset + len <= line->offset + line->len) {
+			line->last_use = use_counter;
+			cache_hits++;
+			return &line->data[offset - line->offset];
+		}
+
+		if (line->last_use < victim->last_use) {
+			victim = line;
+		}
+	}
+
+	cache_misses++;
+
+	/* Read ahead: the following rows or glyphs are likely drawn next */
+	uint32_t fill = MIN(CONFIG_MICROUI_ASSET_CACHE_LINE_SIZE, storage->size - offset);
+	int ret = storage->read(storage, offset, victim->data, fill);
+
+	if (ret < 0) {
+		LOG_ERR("Failed to read asset data at %u: %d", offset, ret);
+		victim->storage = NULL;
+		victim->last_use = 0;
+		return NULL;
+	}
+
+	victim->storage = storage;
+	victim->offset = offset;
+	victim->len = fill;
+	victim->last_use = use_counter;
+
+	return victim->data;
+}
+
+void mu_asset_cache_invalidate(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		cache[i].storage = NULL;
+		cache[i].last_use = 0;
+	}
+}
+
+void mu_asset_cache_counters(uint32_t *hits, uint32_t *misses)
+{
+	*hits = cache_hits;
+	*misses = cache_misses;
+	cache_hits = 0;
+	cache_misses = 0;
+}
+
+int mu_asset_xip_read(const struct mu_AssetStorage *storage, uint32_t offset, void *buf,
+		      size_t len)
+{
+	memcpy(buf, (const uint8_t *)storage->user_data + offset, len);
+	return 0;
+}
+
+#ifdef CONFIG_FLASH_MAP
+int mu_asset_flash_area_read(const struct mu_AssetStorage *storage, uint32_t offset, void *buf,
+			     size_t len)
+{
+	const struct flash_area *area;
+	int ret = flash_area_open((uint8_t)storage->user_data, &area);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = flash_area_read(area, offset, buf, len);
+	flash_area_close(area);
+
+	return ret;
+}
+#endif /* CONFIG_FLASH_MAP */
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file bundle.c
+ * @brief Loader for binary asset bundles
+ */
+
+#include <microui/bundle.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(microui_bundle, LOG_LEVEL_INF);
+
+#ifdef CONFIG_MICROUI_FONT_KERNING
+#define KERNING_SIZE sizeof(struct mu_FontKerningPair)
+#else
+#define KERNING_SIZE 0
+#endif
+
+/* A bundle stored at start whose pointers are resolved for base */
+struct bundle_view {
+	uintptr_t start;
+	uintptr_t base;
+	uint32_t size;
+};
+
+/* Check that ptr (resolved for base) points to len bytes within the bundle */
+static bool in_bundle(const struct bundle_view *view, const void *ptr, size_t len, size_t align)
+{
+	uintptr_t offset = (uintptr_t)ptr - view->base;
+
+	return offset <= view->size && len <= view->size - offset && offset % align == 0;
+}
+
+/* Where ptr (resolved for base) points to in the bundle as stored */
+static void *local(const struct bundle_view *view, const void *ptr)
+{
+	return (void *)(view->start + ((uintptr_t)ptr - view->base));
+}
+
+static int check_header(const struct mu_BundleHeader *header, size_t size)
+{
+	if ((uintptr_t)header % MU_BUNDLE_ALIGN != 0 || size < sizeof(*header) ||
+	    header->magic != MU_BUNDLE_MAGIC) {
+		LOG_ERR("Not an asset bundle");
+		return -EINVAL;
+	}
+
+	if (header->version != MU_BUNDLE_VERSION) {
+		LOG_ERR("Unsupported asset bundle version %u", header->version);
+		return -EINVAL;
+	}
+
+	if (header->size < sizeof(*header) || header->size > size ||
+	    header->entry_count >
+		    (header->size - sizeof(*header)) / sizeof(struct mu_BundleEntry)) {
+		LOG_ERR("Asset bundle truncated");
+		return -EINVAL;
+	}
+
+	if (header->pointer_size != sizeof(void *) ||
+	    header->font_size != sizeof(struct mu_FontDescriptor) ||
+	    header->glyph_size != sizeof(struct mu_FontGlyph) ||
+	    header->kerning_size != KERNING_SIZE ||
+	    header->image_size != sizeof(struct mu_ImageDescriptor)) {
+		LOG_ERR("Asset bundle generated for a different configuration");
+		return -EINVAL;
+	}
+
+	if (crc32_ieee((const uint8_t *)header + sizeof(*header),
+		       header->size - sizeof(*header)) != header->crc32) {
+		LOG_ERR("Asset bundle checksum mismatch");
+		return -EBADMSG;
+	}
+
+	return 0;
+}
+
+static int check_font(const struct bundle_view *view, struct mu_FontDescriptor *font,
+		      bool relocate)
+{
+	uintptr_t delta = view->start - view->base;
+
+	if (font->glyph_count > view->size / sizeof(struct mu_FontGlyph) ||
+	    !in_bundle(view, font->glyphs, font->glyph_count * sizeof(struct mu_FontGlyph),
+		       __alignof__(struct mu_FontGlyph))) {
+		return -EINVAL;
+	}
+
+	struct mu_FontGlyph *glyphs = local(view, font->glyphs);
+
+	for (uint32_t i = 0; i < font->glyph_count; i++) {
+		struct mu_FontGlyph *glyph = &glyphs[i];
+
+		if (!in_bundle(view, glyph->bitmap, (glyph->width * glyph->height + 7) / 8, 1)) {
+			return -EINVAL;
+		}
+		if (relocate) {
+			glyph->bitmap = (const uint8_t *)((uintptr_t)glyph->bitmap + delta);
+		}
+	}
+
+#ifdef CONFIG_MICROUI_FONT_KERNING
+	if (font->kerning_count > view->size / sizeof(struct mu_FontKerningPair) ||
+	    !in_bundle(view, font->kerning_pairs,
+		       font->kerning_count * sizeof(struct mu_FontKerningPair),
+		       __alignof__(struct mu_FontKerningPair))) {
+		return -EINVAL;
+	}
+	if (relocate) {
+		font->kerning_pairs = (const void *)((uintptr_t)font->kerning_pairs + delta);
+	}
+#endif /* CONFIG_MICROUI_FONT_KERNING */
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	if (font->storage != NULL) {
+		return -EINVAL;
+	}
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+	if (relocate) {
+		font->glyphs = (const void *)((uintptr_t)font->glyphs + delta);
+	}
+
+	return 0;
+}
+
+static int check_image(const struct bundle_view *view, struct mu_ImageDescriptor *image,
+		       bool relocate)
+{
+	if ((uint64_t)image->stride * image->height > image->data_size ||
+	    !in_bundle(view, image->data, image->data_size, 1)) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	if (image->storage != NULL) {
+		return -EINVAL;
+	}
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+	if (relocate) {
+		image->data = (const uint8_t *)((uintptr_t)image->data + view->start - view->base);
+	}
+
+	return 0;
+}
+
+/* Validate all entries, and with relocate resolve their pointers for start */
+static int check_entries(const struct bundle_view *view, bool relocate)
+{
+	const struct mu_BundleHeader *header = (const void *)view->start;
+	const struct mu_BundleEntry *entries = (const void *)(view->start + sizeof(*header));
+
+	for (uint32_t i = 0; i < header->entry_count; i++) {
+		const struct mu_BundleEntry *entry = &entries[i];
+		const void *desc = (const void *)(view->base + entry->offset);
+		size_t desc_size = 0;
+		int ret = -EINVAL;
+
+		if (entry->type == MU_BUNDLE_ENTRY_FONT) {
+			desc_size = sizeof(struct mu_FontDescriptor);
+		} else if (entry->type == MU_BUNDLE_ENTRY_IMAGE) {
+			desc_size = sizeof(struct mu_ImageDescriptor);
+		}
+
+		if (desc_size != 0 && in_bundle(view, desc, desc_size, MU_BUNDLE_ALIGN)) {
+			if (entry->type == MU_BUNDLE_ENTRY_FONT) {
+				ret = check_font(view, local(view, desc), relocate);
+			} else {
+				ret = check_image(view, local(view, desc), relocate);
+			}
+		}
+
+		if (ret < 0) {
+			LOG_ERR("Invalid asset bundle entry %.*s", MU_BUNDLE_NAME_LEN, entry->name);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int mu_bundle_open(struct mu_AssetBundle *bundle, const void *data, size_t size)
+{
+	const struct mu_BundleHeader *header = data;
+	int ret = check_header(header, size);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (header->base != (uintptr_t)data) {
+		LOG_ERR("Asset bundle generated for address 0x%llx, stored at %p",
+			(unsigned long long)header->base, data);
+		return -EFAULT;
+	}
+
+	struct bundle_view view = {
+		.start = (uintptr_t)data,
+		.base = (uintptr_t)data,
+		.size = header->size,
+	};
+
+	/* Nothing is written when not relocating */
+	ret = check_entries(&view, false);
+	if (ret < 0) {
+		return ret;
+	}
+
+	bundle->header = header;
+	bundle->entries = (const void *)(header + 1);
+
+	return 0;
+}
+
+int mu_bundle_relocate(void *data, size_t size)
+{
+	struct mu_BundleHeader *header = data;
+	int ret = check_header(header, size);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (header->base == (uintptr_t)data) {
+		return 0;
+	}
+
+	if (header->base > UINTPTR_MAX) {
+		return -EFAULT;
+	}
+
+	struct bundle_view view = {
+		.start = (uintptr_t)data,
+		.base = (uintptr_t)header->base,
+		.size = header->size,
+	};
+
+	/* Validate everything first, so a bad bundle is left untouched */
+	ret = check_entries(&view, false);
+	if (ret < 0) {
+		return ret;
+	}
+	check_entries(&view, true);
+
+	header->base = (uintptr_t)data;
+	header->crc32 = crc32_ieee((const uint8_t *)data + sizeof(*header),
+				   header->size - sizeof(*header));
+
+	return 0;
+}
+
+static const void *find_entry(const struct mu_AssetBundle *bundle, const char *name,
+			      enum mu_BundleEntryType type)
+{
+	for (uint32_t i = 0; i < bundle->header->entry_count; i++) {
+		const struct mu_BundleEntry *entry = &bundle->entries[i];
+
+		if (entry->type == type && strncmp(entry->name, name, MU_BUNDLE_NAME_LEN) == 0) {
+			return (const uint8_t *)bundle->header + entry->offset;
+		}
+	}
+
+	LOG_WRN("Asset %s not found in bundle", name);
+	return NULL;
+}
+
+const struct mu_FontDescriptor *mu_bundle_font(const struct mu_AssetBundle *bundle,
+					       const char *name)
+{
+	return find_entry(bundle, name, MU_BUNDLE_ENTRY_FONT);
+}
+
+const struct mu_ImageDescriptor *mu_bundle_image(const struct mu_AssetBundle *bundle,
+						 const char *name)
+{
+	return find_entry(bundle, name, MU_BUNDLE_ENTRY_IMAGE);
+}
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file gesture.c
+ * @brief Touch gesture recognition for MicroUI
+ *
+ * The recognizer registers its own callback on the touch device, so it sees
+ * every input event with its own timestamp regardless of how often frames
+ * run. Gestures are handed to the event loop through a lock-free queue.
+ */
+
+#include <microui/gesture.h>
+#include <microui/zmu.h>
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/spsc_lockfree.h>
+#include <zephyr/sys/util.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(microui_gesture, LOG_LEVEL_INF);
+
+#define TOUCH_DEV                                                                                  \
+	COND_CODE_1(DT_HAS_CHOSEN(zephyr_touch), DEVICE_DT_GET(DT_CHOSEN(zephyr_touch)), NULL)
+
+#define GESTURE_QUEUE_SIZE   8
+#define GESTURE_MAX_TOUCHES  2
+#define GESTURE_HISTORY_SIZE 8
+/* Only samples this recent contribute to the release velocity */
+#define GESTURE_VELOCITY_WINDOW_US 100000
+/* Minimum relative change between two reported pinch scales */
+#define GESTURE_PINCH_STEP 0.05f
+
+enum long_press_state {
+	LONG_PRESS_IDLE = 0,
+	LONG_PRESS_ARMED,
+	LONG_PRESS_FIRED,
+	LONG_PRESS_REPORTED,
+};
+
+struct touch_point {
+	int x;
+	int y;
+	bool down;
+};
+
+struct touch_sample {
+	int x;
+	int y;
+	uint32_t timestamp;
+};
+
+SPSC_DEFINE(gesture_events, struct mu_Gesture, GESTURE_QUEUE_SIZE);
+
+/* State below is owned by the input callback, except where atomic */
+static struct touch_point touches[GESTURE_MAX_TOUCHES];
+static bool primary_down;
+static bool multi_touch;
+static bool moved;
+static mu_Vec2 down_pos;
+static uint32_t down_time;
+
+/* Recent positions of the primary touch, oldest overwritten first */
+static struct touch_sample history[GESTURE_HISTORY_SIZE];
+static int history_count;
+static int history_head;
+
+static bool pinching;
+static mu_Real pinch_start_distance;
+static mu_Real pinch_last_scale;
+
+static atomic_t long_press;
+static void long_press_expired(struct k_timer *timer);
+static K_TIMER_DEFINE(long_press_timer, long_press_expired, NULL);
+
+static void long_press_expired(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	if (atomic_cas(&long_press, LONG_PRESS_ARMED, LONG_PRESS_FIRED)) {
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+		mu_request_frame();
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+	}
+}
+
+static void long_press_cancel(void)
+{
+	if (atomic_cas(&long_press, LONG_PRESS_ARMED, LONG_PRESS_IDLE)) {
+		k_timer_stop(&long_press_timer);
+	}
+}
+
+static void long_press_gesture(struct mu_Gesture *gesture)
+{
+	*gesture = (struct mu_Gesture){
+		.type = MU_GESTURE_LONG_PRESS,
+		.pos = down_pos,
+		.scale = 1.0f,
+		.timestamp = down_time + k_ms_to_cyc_ceil32(CONFIG_MICROUI_GESTURE_LONG_PRESS_MS),
+	};
+}
+
+static void push_gesture(const struct mu_Gesture *gesture)
+{
+	struct mu_Gesture *slot = spsc_acquire(&gesture_events);
+
+	if (!slot) {
+		LOG_WRN("Gesture queue full, dropping gesture");
+		return;
+	}
+
+	*slot = *gesture;
+	spsc_produce(&gesture_events);
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	mu_request_frame();
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+}
+
+static void history_add(int x, int y, uint32_t timestamp)
+{
+	history[history_head] = (struct touch_sample){x, y, timestamp};
+	history_head = (history_head + 1) % GESTURE_HISTORY_SIZE;
+	history_count = MIN(history_count + 1, GESTURE_HISTORY_SIZE);
+}
+
+static void release_velocity(mu_Real *vx, mu_Real *vy)
+{
+	const struct touch_sample *newest =
+		&history[(history_head + GESTURE_HISTORY_SIZE - 1) % GESTURE_HISTORY_SIZE];
+	const struct touch_sample *oldest = newest;
+
+	*vx = 0;
+	*vy = 0;
+
+	for (int i = 2; i <= history_count; i++) {
+		const struct touch_sample *sample =
+			&history[(history_head + GESTURE_HISTORY_SIZE - i) % GESTURE_HISTORY_SIZE];
+
+		if (k_cyc_to_us_floor32(newest->timestamp - sample->timestamp) >
+		    GESTURE_VELOCITY_WINDOW_US) {
+			break;
+		}
+		oldest = sample;
+	}
+
+	uint32_t dt_us = k_cyc_to_us_floor32(newest->timestamp - oldest->timestamp);
+
+	if (dt_us == 0) {
+		return;
+	}
+
+	*vx = (mu_Real)(newest->x - oldest->x) * 1000000.0f / (mu_Real)dt_us;
+	*vy = (mu_Real)(newest->y - oldest->y) * 1000000.0f / (mu_Real)dt_us;
+}
+
+static enum mu_gesture_direction dominant_direction(int dx, int dy)
+{
+	if (abs(dx) >= abs(dy)) {
+		return dx < 0 ? MU_GESTURE_LEFT : MU_GESTURE_RIGHT;
+	}
+	return dy < 0 ? MU_GESTURE_UP : MU_GESTURE_DOWN;
+}
+
+static void primary_pressed(const struct touch_point *touch, uint32_t timestamp)
+{
+	primary_down = true;
+	multi_touch = false;
+	moved = false;
+	down_pos = mu_vec2(touch->x, touch->y);
+	down_time = timestamp;
+	history_count = 0;
+	history_add(touch->x, touch->y, timestamp);
+
+	atomic_set(&long_press, LONG_PRESS_ARMED);
+	k_timer_start(&long_press_timer, K_MSEC(CONFIG_MICROUI_GESTURE_LONG_PRESS_MS), K_NO_WAIT);
+}
+
+static void primary_moved(const struct touch_point *touch, uint32_t timestamp)
+{
+	history_add(touch->x, touch->y, timestamp);
+
+	if (!moved && (abs(touch->x - down_pos.x) > CONFIG_MICROUI_GESTURE_TOUCH_SLOP ||
+		       abs(touch->y - down_pos.y) > CONFIG_MICROUI_GESTURE_TOUCH_SLOP)) {
+		moved = true;
+		long_press_cancel();
+	}
+}
+
+static void primary_released(const struct touch_point *touch, uint32_t timestamp)
+{
+	/* Include the release, so a touch that stopped before lifting has no velocity */
+	history_add(touch->x, touch->y, timestamp);
+	primary_down = false;
+	k_timer_stop(&long_press_timer);
+
+	atomic_val_t state = atomic_get(&long_press);
+
+	/* A fired long press not taken by the event loop yet is queued, as the
+	 * next touch rearms it
+	 */
+	if (state == LONG_PRESS_FIRED && atomic_cas(&long_press, LONG_PRESS_FIRED, LONG_PRESS_IDLE)) {
+		struct mu_Gesture gesture;
+
+		long_press_gesture(&gesture);
+		push_gesture(&gesture);
+	} else {
+		atomic_set(&long_press, LONG_PRESS_IDLE);
+	}
+
+	/* A long press or pinch consumes the whole touch sequence */
+	if (state == LONG_PRESS_FIRED || state == LONG_PRESS_REPORTED || multi_touch || !moved) {
+		return;
+	}
+
+	const struct touch_sample *last =
+		&history[(history_head + GESTURE_HISTORY_SIZE - 1) % GESTURE_HISTORY_SIZE];
+	struct mu_Gesture gesture = {
+		.pos = down_pos,
+		.delta = mu_vec2(last->x - down_pos.x, last->y - down_pos.y),
+		.scale = 1.0f,
+		.timestamp = timestamp,
+	};
+
+	release_velocity(&gesture.velocity_x, &gesture.velocity_y);
+	gesture.direction = dominant_direction(gesture.delta.x, gesture.delta.y);
+
+	mu_Real speed = sqrtf(gesture.velocity_x * gesture.velocity_x +
+			      gesture.velocity_y * gesture.velocity_y);
+
+	if (speed >= CONFIG_MICROUI_GESTURE_FLING_VELOCITY) {
+		gesture.type = MU_GESTURE_FLING;
+	} else if (abs(gesture.delta.x) >= CONFIG_MICROUI_GESTURE_SWIPE_DISTANCE ||
+		   abs(gesture.delta.y) >= CONFIG_MICROUI_GESTURE_SWIPE_DISTANCE) {
+		gesture.type = MU_GESTURE_SWIPE;
+	} else {
+		return;
+	}
+
+	push_gesture(&gesture);
+}
+
+static void update_pinch(uint32_t timestamp)
+{
+	if (!touches[0].down || !touches[1].down) {
+		pinching = false;
+		return;
+	}
+
+	mu_Real dx = (mu_Real)(touches[1].x - touches[0].x);
+	mu_Real dy = (mu_Real)(touches[1].y - touches[0].y);
+	mu_Real distance = sqrtf(dx * dx + dy * dy);
+
+	if (!pinching) {
+		pinching = true;
+		multi_touch = true;
+		long_press_cancel();
+		pinch_start_distance = MAX(distance, 1.0f);
+		pinch_last_scale = 1.0f;
+		return;
+	}
+
+	mu_Real scale = distance / pinch_start_distance;
+
+	if (fabsf(scale - pinch_last_scale) < GESTURE_PINCH_STEP * pinch_last_scale) {
+		return;
+	}
+	pinch_last_scale = scale;
+
+	struct mu_Gesture gesture = {
+		.type = MU_GESTURE_PINCH,
+		.pos = mu_vec2((touches[0].x + touches[1].x) / 2, (touches[0].y + touches[1].y) / 2),
+		.scale = scale,
+		.timestamp = timestamp,
+	};
+
+	push_gesture(&gesture);
+}
+
+static void gesture_input_callback(struct input_event *event, void *user_data)
+{
+	static int slot;
+
+	ARG_UNUSED(user_data);
+
+	switch (event->code) {
+#ifdef INPUT_ABS_MT_SLOT
+	case INPUT_ABS_MT_SLOT:
+		slot = CLAMP(event->value, 0, GESTURE_MAX_TOUCHES);
+		break;
+#endif /* INPUT_ABS_MT_SLOT */
+	case INPUT_ABS_X:
+		if (slot < GESTURE_MAX_TOUCHES) {
+			touches[slot].x = event->value;
+		}
+		break;
+	case INPUT_ABS_Y:
+		if (slot < GESTURE_MAX_TOUCHES) {
+			touches[slot].y = event->value;
+		}
+		break;
+	case INPUT_BTN_TOUCH:
+		if (slot < GESTURE_MAX_TOUCHES) {
+			touches[slot].down = event->value;
+		}
+		break;
+	default:
+		return;
+	}
+
+	if (!event->sync) {
+		return;
+	}
+
+	uint32_t timestamp = k_cycle_get_32();
+
+	if (touches[0].down && !primary_down) {
+		primary_pressed(&touches[0], timestamp);
+	} else if (touches[0].down) {
+		primary_moved(&touches[0], timestamp);
+	} else if (primary_down) {
+		primary_released(&touches[0], timestamp);
+	}
+
+	update_pinch(timestamp);
+}
+
+INPUT_CALLBACK_DEFINE(TOUCH_DEV, gesture_input_callback, NULL);
+
+bool mu_gesture_get(struct mu_Gesture *gesture)
+{
+	if (atomic_cas(&long_press, LONG_PRESS_FIRED, LONG_PRESS_REPORTED)) {
+		long_press_gesture(gesture);
+		return true;
+	}
+
+	struct mu_Gesture *next = spsc_consume(&gesture_events);
+
+	if (!next) {
+		return false;
+	}
+
+	*gesture = *next;
+	spsc_release(&gesture_events);
+	return true;
+}
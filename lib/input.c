@@ -7,14 +7,20 @@
 #include <microui/zmu.h>
 #include <zephyr/kernel.h>
 #include <zephyr/input/input.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/spsc_lockfree.h>
+#include <string.h>
 
-#include <zephyr/logging/log.h>
-LOG_MODULE_REGISTER(microui_input, LOG_LEVEL_INF);
+#include "input.h"
+#include "trace.h"
 
 #define TOUCH_DEV                                                                                  \
 	COND_CODE_1(DT_HAS_CHOSEN(zephyr_touch), DEVICE_DT_GET(DT_CHOSEN(zephyr_touch)), NULL)
 
 struct microui_input {
+	/* Number of transitions before this one */
+	uint32_t seq;
+	uint32_t timestamp;
 	uint16_t x;
 	uint16_t y;
 
@@ -23,14 +29,114 @@ struct microui_input {
 	uint8_t up: 1;
 };
 
-K_MSGQ_DEFINE(input_events, sizeof(struct microui_input), 12, 4);
+/* Button transitions only, written by the input callback and read by the
+ * event loop. Moves are coalesced into latest_position instead.
+ */
+SPSC_DEFINE(input_events, struct microui_input, CONFIG_MICROUI_INPUT_QUEUE_SIZE);
+
+/* Number of transitions reported by the input callback, including those that
+ * did not fit the queue. Presses and releases alternate, starting with a press,
+ * so the event loop rebuilds missing ones from their count and the latest
+ * position.
+ */
+static atomic_t transition_count;
+static uint32_t transitions_handled;
+
+/* Pointer position of the most recent event packed as (x << 16) | y */
+static atomic_t latest_position;
+static atomic_t latest_position_time;
+static atomic_t position_changed;
 
 static struct microui_input pending_input;
 static bool pending_input_valid = false;
 
+#ifdef CONFIG_MICROUI_INPUT_LATENCY
+/* Timestamp of the oldest event applied since the end of the last frame */
+static uint32_t latency_start;
+static bool latency_pending;
+static struct mu_InputLatency latency;
+
+static void latency_track(uint32_t timestamp)
+{
+	if (!latency_pending || (int32_t)(timestamp - latency_start) < 0) {
+		latency_start = timestamp;
+		latency_pending = true;
+	}
+}
+
+void mu_input_latency_frame_end(bool presented)
+{
+	if (!latency_pending) {
+		return;
+	}
+	latency_pending = false;
+
+	/* Input that caused no redraw has nothing to show on the display */
+	if (!presented) {
+		return;
+	}
+
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - latency_start);
+	uint32_t latency_ms = latency_us / 1000;
+	int bucket = 0;
+
+	while (latency_ms && bucket < MU_INPUT_LATENCY_BUCKETS - 1) {
+		latency_ms >>= 1;
+		bucket++;
+	}
+
+	latency.buckets[bucket]++;
+	latency.count++;
+	latency.total_us += latency_us;
+	latency.max_us = MAX(latency.max_us, latency_us);
+}
+
+void mu_get_input_latency(struct mu_InputLatency *result)
+{
+	*result = latency;
+}
+
+void mu_reset_input_latency(void)
+{
+	memset(&latency, 0, sizeof(latency));
+}
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
+
+/* Get the next button transition from the queue, or rebuild it if it did not fit */
+static bool next_transition(struct microui_input *transition)
+{
+	/* Transitions are queued before they are counted, so any counted one
+	 * missing from the queue now has been dropped by the callback.
+	 */
+	uint32_t count = (uint32_t)atomic_get(&transition_count);
+	struct microui_input *input_evt = spsc_peek(&input_events);
+
+	if (input_evt && input_evt->seq == transitions_handled) {
+		*transition = *spsc_consume(&input_events);
+		spsc_release(&input_events);
+	} else if (input_evt || count != transitions_handled) {
+		uint32_t position = (uint32_t)atomic_get(&latest_position);
+		bool down = !(transitions_handled & 1);
+
+		*transition = (struct microui_input){
+			.seq = transitions_handled,
+			.timestamp = (uint32_t)atomic_get(&latest_position_time),
+			.x = position >> 16,
+			.y = position & 0xFFFF,
+			.mouse_button = MU_MOUSE_LEFT,
+			.down = down,
+			.up = !down,
+		};
+	} else {
+		return false;
+	}
+
+	transitions_handled++;
+	return true;
+}
+
 bool mu_handle_input_events(void)
 {
-	struct microui_input input_evt;
 	mu_Context *mu_ctx = mu_get_context();
 	bool events_handled = false;
 
@@ -46,60 +152,104 @@ bool mu_handle_input_events(void)
 		}
 		pending_input_valid = false;
 		events_handled = true;
+#ifdef CONFIG_MICROUI_INPUT_LATENCY
+		latency_track(pending_input.timestamp);
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
 	}
 
-	/* Drain incoming events. We always apply moves immediately so the
-	   pointer is up-to-date. For a button event we apply only the move and
-	   defer the button change until the next call of this function. */
-	while (k_msgq_get(&input_events, &input_evt, K_NO_WAIT) == 0) {
-		mu_input_mousemove(mu_ctx, input_evt.x, input_evt.y);
-		events_handled = true;
+	/* Take the next button transition in order. Only its move is applied
+	   now; the button change is deferred until the next call of this
+	   function (so it happens after a frame has run with the new mouse
+	   position). */
+	if (next_transition(&pending_input)) {
+		pending_input_valid = true;
+		MU_TRACE(input_get, pending_input.down,
+			 ((uint32_t)pending_input.x << 16) | pending_input.y);
 
-		if (input_evt.down || input_evt.up) {
-			/* Defer button event till next loop iteration (so it happens after
-			   a frame has run with the new mouse position). */
-			pending_input = input_evt;
-			pending_input_valid = true;
-			break;
-		}
+		mu_input_mousemove(mu_ctx, pending_input.x, pending_input.y);
+		/* Restore the latest position once all transitions are handled */
+		atomic_set(&position_changed, 1);
+#ifdef CONFIG_MICROUI_INPUT_FAST_PATH
+		/* Run the frame applying the button right after this one */
+		mu_request_frame_immediate();
+#endif /* CONFIG_MICROUI_INPUT_FAST_PATH */
+		return true;
+	}
+
+	if (atomic_cas(&position_changed, 1, 0)) {
+		uint32_t position = (uint32_t)atomic_get(&latest_position);
+
+		mu_input_mousemove(mu_ctx, position >> 16, position & 0xFFFF);
+		MU_TRACE(input_move, 0, position);
+		events_handled = true;
+#ifdef CONFIG_MICROUI_INPUT_LATENCY
+		latency_track((uint32_t)atomic_get(&latest_position_time));
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
 	}
 
 	return events_handled;
 }
 
+/* Queue a button transition. One that does not fit is only counted, and
+ * rebuilt by the event loop once it gets to it.
+ */
+static void transition_push(uint16_t x, uint16_t y, uint32_t timestamp)
+{
+	static uint32_t count;
+	struct microui_input *input_evt = spsc_acquire(&input_events);
+	bool down = !(count & 1);
+
+	if (input_evt) {
+		*input_evt = (struct microui_input){
+			.seq = count,
+			.timestamp = timestamp,
+			.x = x,
+			.y = y,
+			.mouse_button = MU_MOUSE_LEFT,
+			.down = down,
+			.up = !down,
+		};
+		spsc_produce(&input_events);
+		MU_TRACE(input_put, down, ((uint32_t)x << 16) | y);
+	}
+
+	atomic_set(&transition_count, (atomic_val_t)++count);
+#ifdef CONFIG_MICROUI_INPUT_FAST_PATH
+	mu_request_frame_immediate();
+#endif /* CONFIG_MICROUI_INPUT_FAST_PATH */
+}
+
 static void input_callback(struct input_event *event, void *user_data)
 {
 	static bool mouse_pressed = false;
-	static struct microui_input mu_input;
+	/* Transitions of the current report, queued with its position on sync */
+	static int report_transitions;
+	static uint16_t x;
+	static uint16_t y;
+	/* Only the first touch point of multi-touch devices drives the pointer */
+	static int slot;
 
 	switch (event->code) {
+#ifdef INPUT_ABS_MT_SLOT
+	case INPUT_ABS_MT_SLOT:
+		slot = event->value;
+		break;
+#endif /* INPUT_ABS_MT_SLOT */
 	case INPUT_ABS_X:
-		mu_input.x = event->value;
+		if (slot == 0) {
+			x = event->value;
+		}
 		break;
 	case INPUT_ABS_Y:
-		mu_input.y = event->value;
+		if (slot == 0) {
+			y = event->value;
+		}
 		break;
 	case INPUT_BTN_TOUCH:
-		mu_input.mouse_button = MU_MOUSE_LEFT;
-
-		if (!mouse_pressed) {
-			if (event->value) {
-				mu_input.down = true;
-				mu_input.up = false;
-			} else {
-				mu_input.down = false;
-				mu_input.up = false;
-			}
-		} else {
-			if (event->value) {
-				mu_input.down = false;
-				mu_input.up = false;
-			} else {
-				mu_input.down = false;
-				mu_input.up = true;
-			}
+		if (slot == 0 && mouse_pressed != (bool)event->value) {
+			mouse_pressed = event->value;
+			report_transitions++;
 		}
-		mouse_pressed = event->value;
 		break;
 	default:
 		return;
@@ -109,9 +259,22 @@ static void input_callback(struct input_event *event, void *user_data)
 		return;
 	}
 
-	if (k_msgq_put(&input_events, &mu_input, K_NO_WAIT) != 0) {
-		LOG_WRN("Failed to put message in queue");
+	uint32_t timestamp = k_cycle_get_32();
+
+	/* Publish the position first, so it is never older than a transition
+	   the event loop has already seen. */
+	atomic_set(&latest_position, (atomic_val_t)(((uint32_t)x << 16) | y));
+	atomic_set(&latest_position_time, (atomic_val_t)timestamp);
+
+	for (; report_transitions > 0; report_transitions--) {
+		transition_push(x, y, timestamp);
 	}
+
+	atomic_set(&position_changed, 1);
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	mu_request_frame();
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
 }
 
 INPUT_CALLBACK_DEFINE(TOUCH_DEV, input_callback, NULL);
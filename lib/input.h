@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file input.h
+ * @brief Internal interface between the MicroUI input handling and renderer
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_LIB_INPUT_H_
+#define ZEPHYR_MODULES_MICROUI_LIB_INPUT_H_
+
+#include <stdbool.h>
+
+#ifdef CONFIG_MICROUI_INPUT_LATENCY
+/**
+ * @brief Finish the input latency measurement of a frame.
+ *
+ * For a presented frame, records the time from the oldest input event applied
+ * in it until now. Called by mu_handle_tick() after rendering.
+ *
+ * @param presented Whether the frame was rendered and written to the display.
+ */
+void mu_input_latency_frame_end(bool presented);
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
+
+#endif /* ZEPHYR_MODULES_MICROUI_LIB_INPUT_H_ */
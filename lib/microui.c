@@ -128,6 +128,9 @@ void mu_init(mu_Context *ctx) {
   ctx->draw_frame = draw_frame;
   ctx->_style = default_style;
   ctx->style = &ctx->_style;
+#ifdef CONFIG_MICROUI_ANIMATIONS
+  ctx->anim_active_frame = -1;
+#endif
 }
 
 
@@ -136,6 +139,9 @@ void mu_begin(mu_Context *ctx) {
   ctx->command_list.idx = 0;
   ctx->root_list.idx = 0;
   ctx->scroll_target = NULL;
+#ifdef CONFIG_MICROUI_KINETIC_SCROLL
+  ctx->kinetic_active = 0;
+#endif
   ctx->hover_root = ctx->next_hover_root;
   ctx->next_hover_root = NULL;
   ctx->mouse_delta.x = ctx->mouse_pos.x - ctx->last_mouse_pos.x;
@@ -168,6 +174,15 @@ void mu_end(mu_Context *ctx) {
   if (!ctx->updated_focus) { ctx->focus = 0; }
   ctx->updated_focus = 0;
 
+#ifdef CONFIG_MICROUI_KINETIC_SCROLL
+  /* a press no control took focus for starts dragging the content */
+  if (ctx->mouse_pressed == MU_MOUSE_LEFT && !ctx->focus && ctx->scroll_target) {
+    ctx->kinetic_target = ctx->scroll_target;
+  } else if (!(ctx->mouse_down & MU_MOUSE_LEFT)) {
+    ctx->kinetic_target = NULL;
+  }
+#endif
+
   /* bring hover root to front if mouse was pressed */
   if (ctx->mouse_pressed && ctx->next_hover_root &&
       ctx->next_hover_root->zindex < ctx->last_zindex &&
@@ -464,6 +479,69 @@ int mu_next_command(mu_Context *ctx, mu_Command **cmd) {
 }
 
 
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+/* exact bounds of the pixels touched by the renderer for each primitive */
+static mu_Rect circle_rect(mu_Vec2 center, int radius) {
+  return mu_rect(center.x - radius, center.y - radius, radius * 2 + 1, radius * 2 + 1);
+}
+
+
+static mu_Rect arc_rect(mu_Vec2 center, int radius, int thickness) {
+  /* the stroke is centered on radius, see renderer_draw_arc() */
+  return circle_rect(center, radius + (thickness - 1) / 2);
+}
+
+
+static mu_Rect line_rect(mu_Vec2 p0, mu_Vec2 p1, int thickness) {
+  int half = thickness / 2;
+  return mu_rect(mu_min(p0.x, p1.x) - half, mu_min(p0.y, p1.y) - half,
+                 mu_abs(p1.x - p0.x) + half * 2 + 1,
+                 mu_abs(p1.y - p0.y) + half * 2 + 1);
+}
+
+
+static mu_Rect triangle_rect(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2) {
+  int min_x = mu_min(p0.x, mu_min(p1.x, p2.x));
+  int min_y = mu_min(p0.y, mu_min(p1.y, p2.y));
+  int max_x = mu_max(p0.x, mu_max(p1.x, p2.x));
+  int max_y = mu_max(p0.y, mu_max(p1.y, p2.y));
+  return mu_rect(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+}
+
+
+static mu_Rect image_rect(mu_Context *ctx, mu_Vec2 pos, mu_Image image) {
+  mu_Rect rect = mu_rect(pos.x, pos.y, 1, 1);
+  ctx->img_dimensions(image, &rect.w, &rect.h);
+  return rect;
+}
+#endif
+
+
+mu_Rect mu_command_rect(mu_Context *ctx, mu_Command *cmd) {
+  switch (cmd->type) {
+    case MU_COMMAND_RECT: return cmd->rect.rect;
+    case MU_COMMAND_ICON: return cmd->icon.rect;
+    case MU_COMMAND_TEXT:
+      return mu_rect(cmd->text.pos.x, cmd->text.pos.y,
+        ctx->text_width(cmd->text.font, cmd->text.str, -1),
+        ctx->text_height(cmd->text.font));
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+    case MU_COMMAND_ARC:
+      return arc_rect(cmd->arc.center, cmd->arc.radius, cmd->arc.thickness);
+    case MU_COMMAND_CIRCLE:
+      return circle_rect(cmd->circle.center, cmd->circle.radius);
+    case MU_COMMAND_LINE:
+      return line_rect(cmd->line.p0, cmd->line.p1, cmd->line.thickness);
+    case MU_COMMAND_IMAGE:
+      return image_rect(ctx, cmd->image.pos, cmd->image.image);
+    case MU_COMMAND_TRIANGLE:
+      return triangle_rect(cmd->triangle.p0, cmd->triangle.p1, cmd->triangle.p2);
+#endif
+  }
+  return unclipped_rect;
+}
+
+
 static mu_Command* push_jump(mu_Context *ctx, mu_Command *dst) {
   mu_Command *cmd;
   cmd = mu_push_command(ctx, MU_COMMAND_JUMP, sizeof(mu_JumpCommand));
@@ -515,6 +593,7 @@ void mu_draw_text(mu_Context *ctx, mu_Font font, const char *str, int len,
   cmd->text.pos = pos;
   cmd->text.color = color;
   cmd->text.font = font;
+  cmd->text.clipped = clipped;
   /* reset clipping if it was set */
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
@@ -531,6 +610,7 @@ void mu_draw_icon(mu_Context *ctx, int id, mu_Rect rect, mu_Color color) {
   cmd->icon.id = id;
   cmd->icon.rect = rect;
   cmd->icon.color = color;
+  cmd->icon.clipped = clipped;
   /* reset clipping if it was set */
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
@@ -540,8 +620,7 @@ void mu_draw_arc(mu_Context *ctx, mu_Vec2 center, int radius, int thickness, mu_
 {
   mu_Command *cmd;
   /* do clip command if the rect isn't fully contained within the cliprect */
-  mu_Rect rect = mu_rect(center.x - radius, center.y - radius, radius * 2, radius * 2);
-  int clipped = mu_check_clip(ctx, rect);
+  int clipped = mu_check_clip(ctx, arc_rect(center, radius, thickness));
   if (clipped == MU_CLIP_ALL ) { return; }
   if (clipped == MU_CLIP_PART) { mu_set_clip(ctx, mu_get_clip_rect(ctx)); }
   cmd = mu_push_command(ctx, MU_COMMAND_ARC, sizeof(mu_ArcCommand));
@@ -551,6 +630,7 @@ void mu_draw_arc(mu_Context *ctx, mu_Vec2 center, int radius, int thickness, mu_
   cmd->arc.thickness = thickness;
   cmd->arc.start_angle = start_angle;
   cmd->arc.end_angle = end_angle;
+  cmd->arc.clipped = clipped;
   /* reset clipping if it was set */
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
@@ -559,14 +639,14 @@ void mu_draw_circle(mu_Context *ctx, mu_Vec2 center, int radius, mu_Color color)
 {
   mu_Command *cmd;
   /* do clip command if the rect isn't fully contained within the cliprect */
-  mu_Rect rect = mu_rect(center.x - radius, center.y - radius, radius * 2, radius * 2);
-  int clipped = mu_check_clip(ctx, rect);
+  int clipped = mu_check_clip(ctx, circle_rect(center, radius));
   if (clipped == MU_CLIP_ALL ) { return; }
   if (clipped == MU_CLIP_PART) { mu_set_clip(ctx, mu_get_clip_rect(ctx)); }
   cmd = mu_push_command(ctx, MU_COMMAND_CIRCLE, sizeof(mu_CircleCommand));
   cmd->circle.center = center;
   cmd->circle.radius = radius;
   cmd->circle.color = color;
+  cmd->circle.clipped = clipped;
   /* reset clipping if it was set */
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
@@ -575,10 +655,7 @@ void mu_draw_line(mu_Context *ctx, mu_Vec2 p0, mu_Vec2 p1, int thickness, mu_Col
 {
   mu_Command *cmd;
   /* do clip command if the rect isn't fully contained within the cliprect */
-  mu_Rect rect = mu_rect(mu_min(p0.x, p1.x), mu_min(p0.y, p1.y),
-                        mu_abs(p1.x - p0.x) + thickness,
-                        mu_abs(p1.y - p0.y) + thickness);
-  int clipped = mu_check_clip(ctx, rect);
+  int clipped = mu_check_clip(ctx, line_rect(p0, p1, thickness));
   if (clipped == MU_CLIP_ALL ) { return; }
   if (clipped == MU_CLIP_PART) { mu_set_clip(ctx, mu_get_clip_rect(ctx)); }
   cmd = mu_push_command(ctx, MU_COMMAND_LINE, sizeof(mu_LineCommand));
@@ -586,6 +663,7 @@ void mu_draw_line(mu_Context *ctx, mu_Vec2 p0, mu_Vec2 p1, int thickness, mu_Col
   cmd->line.p1 = p1;
   cmd->line.thickness = thickness;
   cmd->line.color = color;
+  cmd->line.clipped = clipped;
   /* reset clipping if it was set */
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
@@ -593,26 +671,20 @@ void mu_draw_line(mu_Context *ctx, mu_Vec2 p0, mu_Vec2 p1, int thickness, mu_Col
 void mu_draw_image(mu_Context *ctx, mu_Vec2 pos, mu_Image image)
 {
   mu_Command *cmd;
-  mu_Rect rect = mu_rect(pos.x, pos.y, 1, 1);
-  ctx->img_dimensions(image, &rect.w, &rect.h);
-  int clipped = mu_check_clip(ctx, rect);
+  int clipped = mu_check_clip(ctx, image_rect(ctx, pos, image));
   if (clipped == MU_CLIP_ALL ) { return; }
   if (clipped == MU_CLIP_PART) { mu_set_clip(ctx, mu_get_clip_rect(ctx)); }
   cmd = mu_push_command(ctx, MU_COMMAND_IMAGE, sizeof(mu_ImageCommand));
   cmd->image.pos = pos;
   cmd->image.image = image;
+  cmd->image.clipped = clipped;
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
 
 void mu_draw_triangle(mu_Context *ctx, mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color color)
 {
   mu_Command *cmd;
-  int min_x = mu_min(p0.x, mu_min(p1.x, p2.x));
-  int min_y = mu_min(p0.y, mu_min(p1.y, p2.y));
-  int max_x = mu_max(p0.x, mu_max(p1.x, p2.x));
-  int max_y = mu_max(p0.y, mu_max(p1.y, p2.y));
-  mu_Rect rect = mu_rect(min_x, min_y, max_x - min_x, max_y - min_y);
-  int clipped = mu_check_clip(ctx, rect);
+  int clipped = mu_check_clip(ctx, triangle_rect(p0, p1, p2));
   if (clipped == MU_CLIP_ALL ) { return; }
   if (clipped == MU_CLIP_PART) { mu_set_clip(ctx, mu_get_clip_rect(ctx)); }
   cmd = mu_push_command(ctx, MU_COMMAND_TRIANGLE, sizeof(mu_TriangleCommand));
@@ -620,6 +692,7 @@ void mu_draw_triangle(mu_Context *ctx, mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Co
   cmd->triangle.p1 = p1;
   cmd->triangle.p2 = p2;
   cmd->triangle.color = color;
+  cmd->triangle.clipped = clipped;
   if (clipped) { mu_set_clip(ctx, unclipped_rect); }
 }
 
@@ -652,10 +725,26 @@ void mu_layout_end_column(mu_Context *ctx) {
 
 void mu_layout_row(mu_Context *ctx, int items, const int *widths, int height) {
   mu_Layout *layout = get_layout(ctx);
+  int i;
   if (widths) {
     expect(items <= MU_MAX_WIDTHS);
     memcpy(layout->widths, widths, items * sizeof(widths[0]));
   }
+  /* calculate total flex weight and fixed widths once per row so flex items
+  ** can be resolved in constant time by `mu_layout_next` */
+  layout->flex_total = 0;
+  layout->flex_fixed = 0;
+  for (i = 0; i < items; i++) {
+    int w = layout->widths[i];
+    if (MU_IS_FLEX(w)) {
+      layout->flex_total += MU_FLEX_WEIGHT(w);
+    } else if (w > 0) {
+      layout->flex_fixed += w;
+    } else if (w == 0) {
+      layout->flex_fixed += ctx->style->size.x + ctx->style->padding * 2;
+    }
+    /* negative (fill remaining) values handled separately in `mu_layout_next` */
+  }
   layout->items = items;
   layout->position = mu_vec2(layout->indent, layout->next_row);
   layout->size.y = height;
@@ -710,33 +799,14 @@ mu_Rect mu_layout_next(mu_Context *ctx) {
 
     /* handle flex layout */
     if (MU_IS_FLEX(res.w)) {
-      int total_flex = 0;
-      int fixed_width = 0;
-      int flex_count = 0;
-      int i;
-
-      /* calculate total flex weight and fixed widths */
-      for (i = 0; i < layout->items; i++) {
-        int w = layout->widths[i];
-        if (MU_IS_FLEX(w)) {
-          total_flex += MU_FLEX_WEIGHT(w);
-          flex_count++;
-        } else if (w > 0) {
-          fixed_width += w;
-        } else if (w == 0) {
-          fixed_width += style->size.x + style->padding * 2;
-        }
-        /* negative (fill remaining) values handled separately below */
-      }
-
-      if (total_flex > 0) {
+      if (layout->flex_total > 0) {
         /* calculate available space for flex items */
         int total_spacing = (layout->items - 1) * style->spacing;
-        int available = layout->body.w - layout->indent - fixed_width - total_spacing;
+        int available = layout->body.w - layout->indent - layout->flex_fixed - total_spacing;
 
         /* distribute space proportionally based on flex weight */
         int my_flex = MU_FLEX_WEIGHT(res.w);
-        res.w = (available * my_flex) / total_flex;
+        res.w = (available * my_flex) / layout->flex_total;
         if (res.w < 0) { res.w = 0; }
       }
     } else if (res.w < 0) {
@@ -843,15 +913,91 @@ void mu_update_control(mu_Context *ctx, mu_Id id, mu_Rect rect, int opt) {
 }
 
 
+#ifdef CONFIG_MICROUI_TEXT_WRAP_CACHE
+static mu_TextWrap* get_text_wrap(mu_Context *ctx, const char *text,
+  mu_Font font, int width, int *cached)
+{
+  int i, idx = -1, f = ctx->frame, len = strlen(text);
+  mu_Id id = HASH_INITIAL;
+  hash(&id, text, len);
+  hash(&id, &font, sizeof(font));
+  hash(&id, &width, sizeof(width));
+  /* try to get existing line breaks from pool. a hash collision with a text
+  ** of another length re-wraps the text into the slot */
+  idx = mu_pool_get(ctx, ctx->textwrap_pool, MU_TEXTWRAP_SIZE, id);
+  if (idx >= 0) {
+    mu_pool_update(ctx, ctx->textwrap_pool, idx);
+    *cached = ctx->textwraps[idx].text_len == len;
+    if (!*cached) {
+      ctx->textwraps[idx].text_len = len;
+      ctx->textwraps[idx].line_count = 0;
+    }
+    return &ctx->textwraps[idx];
+  }
+  /* not found: take the least recently used slot. unlike `mu_pool_init` this
+  ** doesn't assert if every slot was used this frame, the text is then just
+  ** wrapped without caching */
+  for (i = 0; i < MU_TEXTWRAP_SIZE; i++) {
+    if (ctx->textwrap_pool[i].last_update < f) {
+      f = ctx->textwrap_pool[i].last_update;
+      idx = i;
+    }
+  }
+  if (idx < 0) { return NULL; }
+  ctx->textwrap_pool[idx].id = id;
+  mu_pool_update(ctx, ctx->textwrap_pool, idx);
+  ctx->textwraps[idx].text_len = len;
+  ctx->textwraps[idx].line_count = 0;
+  *cached = 0;
+  return &ctx->textwraps[idx];
+}
+
+
+static mu_TextWrap* push_text_wrap_line(mu_Context *ctx, mu_TextWrap *wrap,
+  int start, int len)
+{
+  if (wrap->line_count == MU_TEXTWRAP_LINES || start + len > UINT16_MAX) {
+    /* doesn't fit: release the slot and stop recording */
+    int idx = wrap - ctx->textwraps;
+    ctx->textwrap_pool[idx].id = 0;
+    ctx->textwrap_pool[idx].last_update = 0;
+    return NULL;
+  }
+  wrap->lines[wrap->line_count].start = start;
+  wrap->lines[wrap->line_count].len = len;
+  wrap->line_count++;
+  return wrap;
+}
+#endif
+
+
 void mu_text(mu_Context *ctx, const char *text) {
   const char *start, *end, *p = text;
   int width = -1;
   mu_Font font = ctx->style->font;
   mu_Color color = ctx->style->colors[MU_COLOR_TEXT];
+  mu_Rect r;
+#ifdef CONFIG_MICROUI_TEXT_WRAP_CACHE
+  int i, cached;
+  mu_TextWrap *wrap;
+#endif
   mu_layout_begin_column(ctx);
   mu_layout_row(ctx, 1, &width, ctx->text_height(font));
-  do {
-    mu_Rect r = mu_layout_next(ctx);
+  r = mu_layout_next(ctx);
+#ifdef CONFIG_MICROUI_TEXT_WRAP_CACHE
+  /* every line has the width of the first, so it can key the cache */
+  wrap = get_text_wrap(ctx, text, font, r.w, &cached);
+  if (wrap && cached) {
+    for (i = 0; i < wrap->line_count; i++) {
+      if (i > 0) { r = mu_layout_next(ctx); }
+      mu_draw_text(ctx, font, text + wrap->lines[i].start, wrap->lines[i].len,
+        mu_vec2(r.x, r.y), color);
+    }
+    mu_layout_end_column(ctx);
+    return;
+  }
+#endif
+  for (;;) {
     int w = 0;
     start = end = p;
     do {
@@ -863,8 +1009,13 @@ void mu_text(mu_Context *ctx, const char *text) {
       end = p++;
     } while (*end && *end != '\n');
     mu_draw_text(ctx, font, start, end - start, mu_vec2(r.x, r.y), color);
+#ifdef CONFIG_MICROUI_TEXT_WRAP_CACHE
+    if (wrap) { wrap = push_text_wrap_line(ctx, wrap, start - text, end - start); }
+#endif
     p = end + 1;
-  } while (*end);
+    if (!*end) { break; }
+    r = mu_layout_next(ctx);
+  }
   mu_layout_end_column(ctx);
 }
 
@@ -1130,6 +1281,107 @@ void mu_end_treenode(mu_Context *ctx) {
 }
 
 
+#ifdef CONFIG_MICROUI_KINETIC_SCROLL
+
+#define KINETIC_FRICTION        3.0f   /* velocity decay per second */
+#define KINETIC_SPRING          150.0f /* overscroll spring stiffness per second^2 */
+#define KINETIC_SPRING_DAMPING  24.0f  /* critically damped for the stiffness above */
+#define KINETIC_MIN_VELOCITY    10.0f  /* pixels per second */
+#define KINETIC_MAX_STEP        0.05f  /* longest step in seconds, keeps the spring stable */
+#define KINETIC_OVERSCROLL      48     /* pixels */
+
+#define overscroll(cnt) ((cnt)->kinetic ? KINETIC_OVERSCROLL : 0)
+
+
+static mu_Real real_abs(mu_Real x) { return x < 0 ? -x : x; }
+
+static int real_round(mu_Real x) { return (int) (x < 0 ? x - 0.5f : x + 0.5f); }
+
+
+/* advances one axis by `dt` seconds; returns non-zero while still in motion */
+static int kinetic_axis(mu_Real *pos, mu_Real *vel, int max, mu_Real dt) {
+  mu_Real edge;
+  if (max <= 0) { *pos = *vel = 0; return 0; }
+  edge = mu_clamp(*pos, 0, max);
+  if (edge != *pos) {
+    /* spring back from overscroll */
+    *vel += (edge - *pos) * KINETIC_SPRING * dt;
+    *vel -= *vel * mu_min(KINETIC_SPRING_DAMPING * dt, 1.0f);
+  } else {
+    *vel -= *vel * mu_min(KINETIC_FRICTION * dt, 1.0f);
+  }
+  *pos += *vel * dt;
+  if (*pos < -KINETIC_OVERSCROLL || *pos > max + KINETIC_OVERSCROLL) {
+    *pos = mu_clamp(*pos, -KINETIC_OVERSCROLL, max + KINETIC_OVERSCROLL);
+    *vel = 0;
+  }
+  edge = mu_clamp(*pos, 0, max);
+  if (real_abs(*vel) < KINETIC_MIN_VELOCITY && real_abs(edge - *pos) < 1.0f) {
+    *pos = edge;
+    *vel = 0;
+    return 0;
+  }
+  return 1;
+}
+
+
+/* `dt` is the real time since the last frame, so slow frames do not inflate the velocity */
+static void kinetic_drag_axis(mu_Real *pos, mu_Real *vel, int max, int delta, mu_Real dt) {
+  if (max <= 0) { *pos = *vel = 0; return; }
+  /* rubber band past the edges */
+  if (*pos < 0 || *pos > max) { delta /= 2; }
+  *pos = mu_clamp(*pos + delta, -KINETIC_OVERSCROLL, max + KINETIC_OVERSCROLL);
+  if (dt > 0) { *vel = (*vel + delta / dt) / 2; }
+}
+
+
+static void kinetic_scroll(mu_Context *ctx, mu_Container *cnt, mu_Vec2 max) {
+  mu_Real dt = (mu_Real) (ctx->curr_time_ms - cnt->kinetic_time_ms) / 1000.0f;
+  int dragging = ctx->kinetic_target == cnt && (ctx->mouse_down & MU_MOUSE_LEFT);
+  cnt->kinetic_time_ms = ctx->curr_time_ms;
+
+  if (!cnt->kinetic) {
+    if (!dragging) { return; }
+    cnt->kinetic_x = cnt->scroll.x;
+    cnt->kinetic_y = cnt->scroll.y;
+    cnt->velocity_x = cnt->velocity_y = 0;
+    cnt->kinetic = 1;
+  }
+
+  if (dragging) {
+    /* content follows the pointer */
+    kinetic_drag_axis(&cnt->kinetic_x, &cnt->velocity_x, max.x, -ctx->mouse_delta.x, dt);
+    kinetic_drag_axis(&cnt->kinetic_y, &cnt->velocity_y, max.y, -ctx->mouse_delta.y, dt);
+  } else {
+    dt = mu_min(dt, KINETIC_MAX_STEP);
+    cnt->kinetic  = kinetic_axis(&cnt->kinetic_x, &cnt->velocity_x, max.x, dt);
+    cnt->kinetic |= kinetic_axis(&cnt->kinetic_y, &cnt->velocity_y, max.y, dt);
+  }
+
+  cnt->scroll.x = real_round(cnt->kinetic_x);
+  cnt->scroll.y = real_round(cnt->kinetic_y);
+  ctx->kinetic_active |= cnt->kinetic;
+}
+
+
+void mu_scroll_fling(mu_Context *ctx, mu_Container *cnt, mu_Real velocity_x, mu_Real velocity_y) {
+  if (!cnt->kinetic) {
+    cnt->kinetic_x = cnt->scroll.x;
+    cnt->kinetic_y = cnt->scroll.y;
+    cnt->kinetic_time_ms = ctx->curr_time_ms;
+    cnt->kinetic = 1;
+  }
+  cnt->velocity_x = velocity_x;
+  cnt->velocity_y = velocity_y;
+}
+
+#else
+
+#define overscroll(cnt) 0
+
+#endif /* CONFIG_MICROUI_KINETIC_SCROLL */
+
+
 #define scrollbar(ctx, cnt, b, cs, x, y, w, h)                              \
   do {                                                                      \
     /* only add scrollbar if content size is larger than body */            \
@@ -1150,13 +1402,15 @@ void mu_end_treenode(mu_Context *ctx) {
         cnt->scroll.y += ctx->mouse_delta.y * cs.y / base.h;                \
       }                                                                     \
       /* clamp scroll to limits */                                          \
-      cnt->scroll.y = mu_clamp(cnt->scroll.y, 0, maxscroll);                \
+      cnt->scroll.y = mu_clamp(cnt->scroll.y, -overscroll(cnt),             \
+                               maxscroll + overscroll(cnt));                \
                                                                             \
       /* draw base and thumb */                                             \
       ctx->draw_frame(ctx, base, MU_COLOR_SCROLLBASE);                      \
       thumb = base;                                                         \
       thumb.h = mu_max(ctx->style->thumb_size, base.h * b->h / cs.y);       \
-      thumb.y += cnt->scroll.y * (base.h - thumb.h) / maxscroll;            \
+      thumb.y += mu_clamp(cnt->scroll.y, 0, maxscroll)                      \
+                 * (base.h - thumb.h) / maxscroll;                          \
       ctx->draw_frame(ctx, thumb, MU_COLOR_SCROLLTHUMB);                    \
                                                                             \
       /* set this as the scroll_target (will get scrolled on mousewheel) */ \
@@ -1177,6 +1431,9 @@ static void scrollbars(mu_Context *ctx, mu_Container *cnt, mu_Rect *body) {
   /* resize body to make room for scrollbars */
   if (cs.y > cnt->body.h) { body->w -= sz; }
   if (cs.x > cnt->body.w) { body->h -= sz; }
+#ifdef CONFIG_MICROUI_KINETIC_SCROLL
+  kinetic_scroll(ctx, cnt, mu_vec2(cs.x - body->w, cs.y - body->h));
+#endif
   /* to create a horizontal or vertical scrollbar almost-identical code is
   ** used; only the references to `x|y` `w|h` need to be switched */
   scrollbar(ctx, cnt, body, cs, x, y, w, h);
@@ -1236,9 +1493,16 @@ int mu_begin_window_ex(mu_Context *ctx, const char *title, mu_Rect rect, int opt
   begin_root_container(ctx, cnt);
   rect = body = cnt->rect;
 
-  /* draw frame */
+  /* draw frame; a window is opaque if the default frame fully covers its
+  ** rect, which allows the renderer to skip anything beneath it. dragging,
+  ** resizing and autosizing change cnt->rect after this, so the rect drawn
+  ** is kept separately */
+  cnt->opaque = 0;
   if (~opt & MU_OPT_NOFRAME) {
     ctx->draw_frame(ctx, rect, MU_COLOR_WINDOWBG);
+    cnt->opaque = ctx->draw_frame == draw_frame &&
+                  ctx->style->colors[MU_COLOR_WINDOWBG].a == 255;
+    cnt->frame_rect = rect;
   }
 
   /* do title bar */
@@ -1351,3 +1615,40 @@ void mu_end_panel(mu_Context *ctx) {
   mu_pop_clip_rect(ctx);
   pop_container(ctx);
 }
+
+
+void mu_begin_list_ex(mu_Context *ctx, const char *name, int row_count, int row_height, int opt) {
+  mu_Container *cnt;
+  mu_Layout *layout;
+  int stride = row_height + ctx->style->spacing;
+  int top;
+  expect(row_height > 0);
+  mu_begin_panel_ex(ctx, name, opt);
+  cnt = mu_get_current_container(ctx);
+  layout = get_layout(ctx);
+  /* only rows intersecting the body are built, the full height is still
+  ** reported through the layout so the scrollbars cover every row */
+  top = cnt->scroll.y - ctx->style->padding;
+  layout->list_index = mu_clamp(top / stride, 0, row_count);
+  layout->list_end = mu_clamp((top + cnt->body.h) / stride + 1, 0, row_count);
+  layout->list_row_height = row_height;
+  if (row_count > 0) {
+    layout->max.y = mu_max(layout->max.y, layout->body.y + row_count * stride - ctx->style->spacing);
+  }
+}
+
+
+int mu_list_row(mu_Context *ctx, int *index) {
+  mu_Layout *layout = get_layout(ctx);
+  int width = -1;
+  if (layout->list_index >= layout->list_end) { return 0; }
+  *index = layout->list_index++;
+  layout->next_row = *index * (layout->list_row_height + ctx->style->spacing);
+  mu_layout_row(ctx, 1, &width, layout->list_row_height);
+  return 1;
+}
+
+
+void mu_end_list(mu_Context *ctx) {
+  mu_end_panel(ctx);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file shell.c
+ * @brief MicroUI shell commands
+ */
+
+#include <microui/zmu.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+static const char *const command_names[MU_COMMAND_MAX] = {
+	[MU_COMMAND_CLIP] = "clip",
+	[MU_COMMAND_RECT] = "rect",
+	[MU_COMMAND_TEXT] = "text",
+	[MU_COMMAND_ICON] = "icon",
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+	[MU_COMMAND_ARC] = "arc",
+	[MU_COMMAND_CIRCLE] = "circle",
+	[MU_COMMAND_LINE] = "line",
+	[MU_COMMAND_IMAGE] = "image",
+	[MU_COMMAND_TRIANGLE] = "triangle",
+#endif /* CONFIG_MICROUI_DRAW_EXTENSIONS */
+};
+
+static void print_hit_rate(const struct shell *sh, const char *name, uint32_t hits,
+			   uint32_t misses)
+{
+	uint32_t lookups = hits + misses;
+
+	shell_print(sh, "%-18s %u/%u hits (%u%%)", name, hits, lookups,
+		    lookups ? (uint32_t)((uint64_t)hits * 100 / lookups) : 0);
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct mu_RenderStats stats;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	mu_get_render_stats(&stats);
+
+	shell_print(sh, "%-10s %8s %10s %10s %10s", "command", "count", "pixels", "blended", "us");
+	for (int type = 0; type < MU_COMMAND_MAX; type++) {
+		const struct mu_CommandStats *cmd = &stats.commands[type];
+
+		if (command_names[type] == NULL) {
+			continue;
+		}
+
+		shell_print(sh, "%-10s %8u %10u %10u %10u", command_names[type], cmd->count,
+			    cmd->pixels, cmd->blended, k_cyc_to_us_floor32(cmd->cycles));
+	}
+
+	shell_print(sh, "");
+	shell_print(sh, "%-18s %u us", "clear", k_cyc_to_us_floor32(stats.clear_cycles));
+	shell_print(sh, "%-18s %u us", "present", k_cyc_to_us_floor32(stats.present_cycles));
+	shell_print(sh, "%-18s %u us", "render", k_cyc_to_us_floor32(stats.render_cycles));
+#ifdef CONFIG_MICROUI_TEXT_WIDTH_CACHE
+	print_hit_rate(sh, "text width cache", stats.text_width_hits, stats.text_width_misses);
+#endif /* CONFIG_MICROUI_TEXT_WIDTH_CACHE */
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	print_hit_rate(sh, "asset cache", stats.asset_cache_hits, stats.asset_cache_misses);
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_microui,
+			       SHELL_CMD(stats, NULL, "Print statistics of the last rendered frame",
+					 cmd_stats),
+			       SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(microui, &sub_microui, "MicroUI commands", NULL);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file trace.h
+ * @brief Trace points of the MicroUI frame pipeline
+ *
+ * Emitted as named events of the Zephyr tracing subsystem, so they show up
+ * next to the kernel events in CTF or SystemView timelines. Event names are
+ * prefixed with "mu_" and kept short, as CTF truncates them.
+ */
+
+#ifndef ZEPHYR_MODULES_MICROUI_LIB_TRACE_H_
+#define ZEPHYR_MODULES_MICROUI_LIB_TRACE_H_
+
+#ifdef CONFIG_MICROUI_TRACING
+#include <zephyr/tracing/tracing.h>
+
+#define MU_TRACE(event, arg0, arg1)                                                                \
+	sys_trace_named_event("mu_" #event, (uint32_t)(arg0), (uint32_t)(arg1))
+#else
+#define MU_TRACE(event, arg0, arg1)                                                                \
+	do {                                                                                       \
+	} while (0)
+#endif /* CONFIG_MICROUI_TRACING */
+
+#ifdef CONFIG_MICROUI_TRACING_COMMANDS
+#define MU_TRACE_COMMAND(event, arg0, arg1) MU_TRACE(event, arg0, arg1)
+#else
+#define MU_TRACE_COMMAND(event, arg0, arg1)                                                        \
+	do {                                                                                       \
+	} while (0)
+#endif /* CONFIG_MICROUI_TRACING_COMMANDS */
+
+#endif /* ZEPHYR_MODULES_MICROUI_LIB_TRACE_H_ */
@@ -18,6 +18,17 @@
 #include <microui/animation.h>
 #endif
 
+#ifdef CONFIG_MICROUI_FRAME_PACING_TE_GPIO
+#include <zephyr/drivers/gpio.h>
+#endif
+
+#ifdef CONFIG_MICROUI_ACCEL
+#include <microui/accel.h>
+#endif
+
+#include "input.h"
+#include "trace.h"
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(microui_zmu, LOG_LEVEL_INF);
 
@@ -50,8 +61,44 @@ static struct display_capabilities display_caps;
 static mu_Context mu_ctx;
 static mu_Color bg_color = {90, 95, 100, 255};
 
+#ifdef CONFIG_MICROUI_RENDER_BANDS
+/* Each band of the display is drawn by its own thread and confined to its rows */
+static Z_THREAD_LOCAL mu_Rect clip_rect;
+static Z_THREAD_LOCAL mu_Rect band_rect;
+#define RENDER_RECT band_rect
+#else
 /* Clipping rectangle */
 static mu_Rect clip_rect = {0, 0, 0, 0};
+#define RENDER_RECT mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT)
+#endif /* CONFIG_MICROUI_RENDER_BANDS */
+
+#ifdef CONFIG_MICROUI_RENDER_STATS
+struct render_counters {
+	struct mu_RenderStats stats;
+	/* Pixels written and blended by the command being drawn */
+	uint32_t pixels;
+	uint32_t blended;
+};
+
+#ifdef CONFIG_MICROUI_RENDER_BANDS
+static struct render_counters frame_counters[CONFIG_MICROUI_RENDER_BAND_THREADS + 1];
+/* Counters of the band drawn by the current thread */
+static Z_THREAD_LOCAL struct render_counters *counters;
+#else
+static struct render_counters frame_counters[1];
+static struct render_counters *const counters = &frame_counters[0];
+#endif /* CONFIG_MICROUI_RENDER_BANDS */
+
+/* Statistics of the last rendered frame */
+static struct mu_RenderStats render_stats;
+static struct k_spinlock render_stats_lock;
+
+#define STATS_PIXELS(n) (counters->pixels += (n))
+#define STATS_BLENDED() (counters->blended++)
+#else
+#define STATS_PIXELS(n)
+#define STATS_BLENDED()
+#endif /* CONFIG_MICROUI_RENDER_STATS */
 
 /* Text width cache */
 #ifdef CONFIG_MICROUI_TEXT_WIDTH_CACHE
@@ -80,7 +127,18 @@ static inline uint32_t fnv1a_hash(const char *text, int len)
 #ifdef CONFIG_MICROUI_EVENT_LOOP
 static struct k_work_q mu_work_queue;
 static K_KERNEL_STACK_DEFINE(mu_work_stack, CONFIG_MICROUI_EVENT_LOOP_STACK_SIZE);
+static atomic_t mu_loop_running;
+/* Display refresh period in hardware cycles */
+static uint32_t frame_period_cyc;
 #endif /* CONFIG_MICROUI_EVENT_LOOP */
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+/* Set by mu_handle_tick() when the next frame must run even without a redraw */
+static bool mu_frame_active;
+/* Set while the loop sleeps with no frame scheduled */
+static atomic_t loop_idle;
+/* Set by mu_request_frame(), keeps the loop from going idle after this frame */
+static atomic_t frame_requested;
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
 static volatile mu_process_frame_cb frame_cb;
 
 static __always_inline const struct mu_FontGlyph *find_glyph(const struct mu_FontDescriptor *font,
@@ -272,6 +330,7 @@ static __always_inline void set_pixel_argb8888(int x, int y, uint32_t pixel)
 	if (src_a == 255) {
 		*p = pixel;
 	} else if (src_a > 0) {
+		STATS_BLENDED();
 		uint32_t dst = *p;
 		uint8_t dst_a = (dst >> 24) & 0xFF;
 		uint8_t dst_r = (dst >> 16) & 0xFF;
@@ -388,6 +447,7 @@ static __always_inline void set_pixel_al88(int x, int y, uint32_t pixel)
 	if (src_a == 255) {
 		*p = (uint16_t)pixel;
 	} else if (src_a > 0) {
+		STATS_BLENDED();
 		uint16_t dst = *p;
 		uint8_t dst_a = (dst >> 8) & 0xFF;
 		uint8_t dst_l = dst & 0xFF;
@@ -468,6 +528,8 @@ static __always_inline uint32_t color_to_pixel(mu_Color color)
 
 static __always_inline void set_pixel_unchecked(int x, int y, uint32_t pixel)
 {
+	STATS_PIXELS(1);
+
 #if ENABLED_CF_COUNT == 1
 #if defined(CONFIG_MICROUI_RENDER_RGB_888)
 	set_pixel_rgb888(x, y, pixel);
@@ -541,20 +603,65 @@ static __always_inline void set_pixel(int x, int y, uint32_t pixel)
 	set_pixel_unchecked(x, y, pixel);
 }
 
-static void renderer_draw_line(mu_Vec2 p0, mu_Vec2 p1, uint8_t thickness, mu_Color color)
+/* Selects the clip checked or unchecked pixel write. Callers pass a compile time constant
+ * so the branch is folded away in the always inlined rasterizers below.
+ */
+static __always_inline void plot_pixel(int x, int y, uint32_t pixel, bool clip)
+{
+	if (clip) {
+		set_pixel(x, y, pixel);
+	} else {
+		set_pixel_unchecked(x, y, pixel);
+	}
+}
+
+/* Returns true if rect lies entirely on the display, or the band being drawn */
+static __always_inline bool rect_on_display(mu_Rect rect)
+{
+	mu_Rect area = RENDER_RECT;
+
+	return rect.x >= area.x && rect.y >= area.y && rect.x + rect.w <= area.x + area.w &&
+	       rect.y + rect.h <= area.y + area.h;
+}
+
+/* Per pixel clipping is only needed if microui reported the command as partially clipped
+ * or if it reaches past the display (or band) edges.
+ */
+static __always_inline bool command_needs_clip(mu_Command *cmd, int clipped)
+{
+	return clipped || !rect_on_display(mu_command_rect(&mu_ctx, cmd));
+}
+
+/* Fills the horizontal span from x0 to x1 (inclusive) on row y. Clipping is applied once
+ * per span rather than per pixel.
+ */
+static __always_inline void draw_hspan(int x0, int x1, int y, uint32_t pixel, bool clip)
+{
+	if (clip) {
+		if (y < clip_rect.y || y >= clip_rect.y + clip_rect.h) {
+			return;
+		}
+		x0 = mu_max(x0, clip_rect.x);
+		x1 = mu_min(x1, clip_rect.x + clip_rect.w - 1);
+	}
+
+	for (int x = x0; x <= x1; x++) {
+		set_pixel_unchecked(x, y, pixel);
+	}
+}
+
+static __always_inline void draw_line(mu_Vec2 p0, mu_Vec2 p1, uint8_t thickness, uint32_t pixel,
+				      bool clip)
 {
 	int dx = abs(p1.x - p0.x);
 	int dy = abs(p1.y - p0.y);
 	int sx = (p0.x < p1.x) ? 1 : -1;
 	int sy = (p0.y < p1.y) ? 1 : -1;
 	int err = dx - dy;
-	uint32_t pixel = color_to_pixel(color);
 
 	while (true) {
 		for (int ty = -thickness / 2; ty <= thickness / 2; ty++) {
-			for (int tx = -thickness / 2; tx <= thickness / 2; tx++) {
-				set_pixel(p0.x + tx, p0.y + ty, pixel);
-			}
+			draw_hspan(p0.x - thickness / 2, p0.x + thickness / 2, p0.y + ty, pixel, clip);
 		}
 
 		if (p0.x == p1.x && p0.y == p1.y) {
@@ -572,17 +679,49 @@ static void renderer_draw_line(mu_Vec2 p0, mu_Vec2 p1, uint8_t thickness, mu_Col
 	}
 }
 
-static __always_inline void draw_glyph(const struct mu_FontGlyph *glyph, int x, int y,
-				       const struct mu_FontDescriptor *font, mu_Color color)
+static void renderer_draw_line(mu_Vec2 p0, mu_Vec2 p1, uint8_t thickness, mu_Color color,
+			       bool clip)
 {
 	uint32_t pixel = color_to_pixel(color);
 
+	if (clip) {
+		draw_line(p0, p1, thickness, pixel, true);
+	} else {
+		draw_line(p0, p1, thickness, pixel, false);
+	}
+}
+
+/* Read count (1 to 32) bits starting at bit pos, most significant bit first */
+static __always_inline uint32_t glyph_bits(const uint8_t *bitmap, uint32_t pos, int count)
+{
+	const uint8_t *byte = &bitmap[pos / 8];
+	int available = 8 - (pos % 8);
+	uint64_t bits = *byte & (0xFF >> (pos % 8));
+
+	while (available < count) {
+		bits = (bits << 8) | *++byte;
+		available += 8;
+	}
+
+	return (uint32_t)(bits >> (available - count));
+}
+
+static __always_inline void draw_glyph(const struct mu_FontDescriptor *font,
+				       const struct mu_FontGlyph *glyph, int x, int y,
+				       uint32_t pixel, bool clip)
+{
+	/* Only the bounding box of the inked pixels is stored and visited */
+	x += glyph->x_offset;
+	y += glyph->y_offset;
+
 	/* Compute visible bounds by intersecting glyph rect with display and clip rect */
-	mu_Rect glyph_rect = mu_rect(x, y, glyph->width, font->height);
-	mu_Rect display_rect = mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	mu_Rect glyph_rect = mu_rect(x, y, glyph->width, glyph->height);
+	mu_Rect display_rect = RENDER_RECT;
 	mu_Rect visible = intersect_rects(glyph_rect, display_rect);
 
-	visible = intersect_rects(visible, clip_rect);
+	if (clip) {
+		visible = intersect_rects(visible, clip_rect);
+	}
 
 	/* Early exit if completely clipped */
 	if (visible.w == 0 || visible.h == 0) {
@@ -597,51 +736,210 @@ static __always_inline void draw_glyph(const struct mu_FontGlyph *glyph, int x,
 
 	for (int row = start_row; row < end_row; row++) {
 		int screen_y = y + row;
-		if (font->bitmap_width <= 8) {
-			uint8_t row_data = glyph->bitmap[row];
-			/* Mask out bits outside the visible range */
-			row_data &= (0xFF >> start_col);
-			row_data &= (0xFF << (8 - end_col));
-			while (row_data) {
-				int col = __builtin_clz((uint32_t)row_data) - 24;
-				set_pixel_unchecked(x + col, screen_y, pixel);
-				row_data &= ~(0x80 >> col);
-			}
-		} else if (font->bitmap_width <= 16) {
-			uint16_t row_data = sys_get_be16(&glyph->bitmap[row * 2]);
-			/* Mask out bits outside the visible range */
-			row_data &= (0xFFFF >> start_col);
-			row_data &= (0xFFFF << (16 - end_col));
-			while (row_data) {
-				int col = __builtin_clz((uint32_t)row_data) - 16;
-				set_pixel_unchecked(x + col, screen_y, pixel);
-				row_data &= ~(0x8000 >> col);
-			}
-		} else if (font->bitmap_width <= 32) {
-			uint32_t row_data = sys_get_be32(&glyph->bitmap[row * 4]);
-			/* Mask out bits outside the visible range */
-			row_data &= (0xFFFFFFFFu >> start_col);
-			row_data &= (0xFFFFFFFFu << (32 - end_col));
-			while (row_data) {
-				int col = __builtin_clz(row_data);
-				set_pixel_unchecked(x + col, screen_y, pixel);
-				row_data &= ~(0x80000000u >> col);
+		int row_pos = row * glyph->width;
+		const uint8_t *bitmap = glyph->bitmap;
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+		if (font->storage) {
+			/* Fetch only the bytes holding the visible part of the row */
+			int first = (row_pos + start_col) / 8;
+			int last = (row_pos + end_col - 1) / 8;
+
+			bitmap = mu_asset_fetch(font->storage, (uintptr_t)glyph->bitmap + first,
+						last - first + 1);
+			if (bitmap == NULL) {
+				continue;
 			}
-		} else {
-			/* bitmap_width <= 64 */
-			uint64_t row_data = sys_get_be64(&glyph->bitmap[row * 8]);
-			/* Mask out bits outside the visible range */
-			row_data &= (0xFFFFFFFFFFFFFFFFull >> start_col);
-			row_data &= (0xFFFFFFFFFFFFFFFFull << (64 - end_col));
+			row_pos -= first * 8;
+		}
+#else
+		ARG_UNUSED(font);
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+		for (int col = start_col; col < end_col; col += 32) {
+			int count = MIN(end_col - col, 32);
+			uint32_t row_data = glyph_bits(bitmap, row_pos + col, count)
+					    << (32 - count);
+
 			while (row_data) {
-				int col = __builtin_clzll(row_data);
-				set_pixel_unchecked(x + col, screen_y, pixel);
-				row_data &= ~(0x8000000000000000ull >> col);
+				int bit = __builtin_clz(row_data);
+
+				set_pixel_unchecked(x + col + bit, screen_y, pixel);
+				row_data &= ~(0x80000000u >> bit);
 			}
 		}
 	}
 }
 
+#ifdef CONFIG_MICROUI_ACCEL
+static const struct mu_Accel *accel;
+static struct mu_AccelSurface accel_target;
+/* Set while submitted operations may still be running */
+static bool accel_busy;
+
+/* Wait for the accelerator before the CPU accesses the frame buffer */
+static void accel_sync(void)
+{
+	if (accel_busy) {
+		accel_busy = false;
+		if (accel->wait(accel) < 0) {
+			LOG_ERR("Accelerator wait failed");
+		}
+	}
+}
+
+void mu_accel_set(const struct mu_Accel *backend)
+{
+	accel_sync();
+	accel = backend;
+}
+
+static bool accel_submitted(int ret)
+{
+	if (ret == 0) {
+		accel_busy = true;
+		return true;
+	}
+
+	if (ret != -ENOTSUP) {
+		LOG_ERR("Accelerator operation failed: %d", ret);
+	}
+	return false;
+}
+
+static bool accel_fill(mu_Rect rect, uint32_t pixel)
+{
+	if (accel->fill == NULL) {
+		return false;
+	}
+
+	return accel_submitted(accel->fill(accel, &accel_target, rect, pixel));
+}
+
+static bool accel_draw_rect(mu_Rect rect, mu_Color color)
+{
+	if (IS_ENABLED(CONFIG_MICROUI_ALPHA_BLENDING) && color.a < 255) {
+		return false;
+	}
+
+	rect = intersect_rects(rect, mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT));
+	if (rect.w == 0 || rect.h == 0) {
+		return true;
+	}
+
+	return accel_fill(rect, color_to_pixel(color));
+}
+
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+static bool accel_draw_image(mu_Vec2 pos, mu_Image image, bool clip)
+{
+	const struct mu_ImageDescriptor *img_desc = (const struct mu_ImageDescriptor *)image;
+
+	/* Images in external storage and bitmaps are drawn in software */
+	if (img_desc == NULL || img_desc->data == NULL ||
+	    img_desc->pixel_format == PIXEL_FORMAT_MONO01 ||
+	    img_desc->pixel_format == PIXEL_FORMAT_MONO10) {
+		return false;
+	}
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	if (img_desc->storage != NULL) {
+		return false;
+	}
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+	mu_Rect visible = intersect_rects(mu_rect(pos.x, pos.y, img_desc->width, img_desc->height),
+					  mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT));
+
+	if (clip) {
+		visible = intersect_rects(visible, clip_rect);
+	}
+	if (visible.w == 0 || visible.h == 0) {
+		return true;
+	}
+
+	/* Same choice of path as renderer_draw_image() */
+	bool blend = IS_ENABLED(CONFIG_MICROUI_ALPHA_BLENDING) &&
+		     (img_desc->pixel_format == PIXEL_FORMAT_ARGB_8888 ||
+		      img_desc->pixel_format == PIXEL_FORMAT_AL_88);
+	int (*op)(const struct mu_Accel *accel, const struct mu_AccelSurface *dst, mu_Vec2 pos,
+		  const struct mu_ImageDescriptor *src, mu_Rect src_rect);
+
+	if (blend) {
+		op = accel->blend_blit;
+	} else if (img_desc->pixel_format == accel_target.format) {
+		op = accel->blit;
+	} else {
+		op = accel->convert_blit;
+	}
+
+	if (op == NULL) {
+		return false;
+	}
+
+	mu_Rect src_rect = mu_rect(visible.x - pos.x, visible.y - pos.y, visible.w, visible.h);
+
+	return accel_submitted(
+		op(accel, &accel_target, mu_vec2(visible.x, visible.y), img_desc, src_rect));
+}
+#endif /* CONFIG_MICROUI_DRAW_EXTENSIONS */
+
+static bool accel_ready(void)
+{
+	/* Bitmap frame buffers are drawn in software */
+	return accel != NULL && accel_target.format != PIXEL_FORMAT_MONO01 &&
+	       accel_target.format != PIXEL_FORMAT_MONO10;
+}
+
+/*
+ * Submit a command to the accelerator. Returns false if it has to be drawn in
+ * software, the frame buffer is then idle.
+ */
+static bool accel_draw(mu_Command *cmd)
+{
+	bool submitted = false;
+
+	if (cmd->type == MU_COMMAND_CLIP) {
+		return false;
+	}
+
+	if (accel_ready()) {
+		switch (cmd->type) {
+		case MU_COMMAND_RECT:
+			submitted = accel_draw_rect(cmd->rect.rect, cmd->rect.color);
+			break;
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+		case MU_COMMAND_IMAGE:
+			submitted = accel_draw_image(cmd->image.pos, cmd->image.image,
+						     cmd->image.clipped);
+			break;
+#endif /* CONFIG_MICROUI_DRAW_EXTENSIONS */
+		default:
+			break;
+		}
+	}
+
+	if (!submitted) {
+		accel_sync();
+	}
+
+	return submitted;
+}
+
+#ifdef CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW
+static bool accel_clear(mu_Color color)
+{
+	bool submitted = accel_ready() &&
+			 accel_draw_rect(mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT), color);
+
+	if (!submitted) {
+		accel_sync();
+	}
+
+	return submitted;
+}
+#endif /* CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW */
+#endif /* CONFIG_MICROUI_ACCEL */
+
 static void renderer_init(void)
 {
 	if (!device_is_ready(display_dev)) {
@@ -657,6 +955,15 @@ static void renderer_init(void)
 	clip_rect.w = DISPLAY_WIDTH;
 	clip_rect.h = DISPLAY_HEIGHT;
 
+#ifdef CONFIG_MICROUI_ACCEL
+	accel_sync();
+	accel_target.buf = display_buffer;
+	accel_target.stride = DISPLAY_STRIDE;
+	accel_target.width = DISPLAY_WIDTH;
+	accel_target.height = DISPLAY_HEIGHT;
+	accel_target.format = display_caps.current_pixel_format;
+#endif /* CONFIG_MICROUI_ACCEL */
+
 	memset(display_buffer, 0, DISPLAY_BUFFER_SIZE);
 
 	LOG_INF("MicroUI renderer initialized for %dx%d display", DISPLAY_WIDTH, DISPLAY_HEIGHT);
@@ -667,7 +974,7 @@ static void renderer_draw_rect(mu_Rect rect, mu_Color color)
 	uint32_t pixel = color_to_pixel(color);
 
 	/* Clamp to display bounds (microui already handled clip rect intersection) */
-	mu_Rect display_rect = mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	mu_Rect display_rect = RENDER_RECT;
 	rect = intersect_rects(rect, display_rect);
 
 	if (rect.w == 0 || rect.h == 0) {
@@ -710,6 +1017,8 @@ static void renderer_draw_rect(mu_Rect rect, mu_Color color)
 		display_buffer + (rect.y * DISPLAY_STRIDE) + (rect.x * DISPLAY_BYTES_PER_PIXEL);
 	int row_bytes = rect.w * DISPLAY_BYTES_PER_PIXEL;
 
+	STATS_PIXELS((rect.h - 1) * rect.w);
+
 	/* Copy first row to subsequent rows */
 	for (int y = 1; y < rect.h; y++) {
 		uint8_t *dst_row = src_row + (y * DISPLAY_STRIDE);
@@ -717,8 +1026,10 @@ static void renderer_draw_rect(mu_Rect rect, mu_Color color)
 	}
 }
 
-static void renderer_draw_text(mu_Font f, const char *text, mu_Vec2 pos, mu_Color color)
+static void renderer_draw_text(mu_Font f, const char *text, mu_Vec2 pos, mu_Color color,
+			       bool clip)
 {
+	uint32_t pixel = color_to_pixel(color);
 	int x = pos.x;
 	const struct mu_FontDescriptor *font = (struct mu_FontDescriptor *)f;
 #ifdef CONFIG_MICROUI_FONT_KERNING
@@ -750,8 +1061,12 @@ static void renderer_draw_text(mu_Font f, const char *text, mu_Vec2 pos, mu_Colo
 
 		const struct mu_FontGlyph *glyph = find_glyph(font, codepoint);
 		if (likely(glyph)) {
-			draw_glyph(glyph, x, pos.y, font, color);
-			x += glyph->width;
+			if (clip) {
+				draw_glyph(font, glyph, x, pos.y, pixel, true);
+			} else {
+				draw_glyph(font, glyph, x, pos.y, pixel, false);
+			}
+			x += glyph->advance;
 		} else {
 			x += font->default_width;
 		}
@@ -760,46 +1075,46 @@ static void renderer_draw_text(mu_Font f, const char *text, mu_Vec2 pos, mu_Colo
 	}
 }
 
-static void renderer_draw_icon(int id, mu_Rect rect, mu_Color color)
+static void renderer_draw_icon(int id, mu_Rect rect, mu_Color color, bool clip)
 {
 	switch (id) {
 	case MU_ICON_CLOSE:
 		renderer_draw_line(
 			(mu_Vec2){rect.x + rect.w / 4, rect.y + rect.h / 4},
 			(mu_Vec2){rect.x + rect.w - rect.w / 4, rect.y + rect.h - rect.h / 4}, 1,
-			color);
+			color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w - rect.w / 4, rect.y + rect.h / 4},
 				   (mu_Vec2){rect.x + rect.w / 4, rect.y + rect.h - rect.h / 4}, 1,
-				   color);
+				   color, clip);
 		break;
 	case MU_ICON_COLLAPSED:
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3},
 				   (mu_Vec2){rect.x + rect.w - rect.w / 3, rect.y + rect.h / 2}, 1,
-				   color);
+				   color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w - rect.w / 3, rect.y + rect.h / 2},
 				   (mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h - rect.h / 3}, 1,
-				   color);
+				   color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h - rect.h / 3},
-				   (mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3}, 1, color);
+				   (mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3}, 1, color, clip);
 		break;
 	case MU_ICON_EXPANDED:
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3},
 				   (mu_Vec2){rect.x + rect.w - rect.w / 3, rect.y + rect.h / 3}, 1,
-				   color);
+				   color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w - rect.w / 3, rect.y + rect.h / 3},
 				   (mu_Vec2){rect.x + rect.w / 2, rect.y + rect.h - rect.h / 3}, 1,
-				   color);
+				   color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 2, rect.y + rect.h - rect.h / 3},
-				   (mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3}, 1, color);
+				   (mu_Vec2){rect.x + rect.w / 3, rect.y + rect.h / 3}, 1, color, clip);
 		break;
 	case MU_ICON_CHECK:
 		// Draw a check mark with some padding
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 4, rect.y + rect.h / 2},
 				   (mu_Vec2){rect.x + rect.w / 2, rect.y + rect.h - rect.h / 4}, 1,
-				   color);
+				   color, clip);
 		renderer_draw_line((mu_Vec2){rect.x + rect.w / 2, rect.y + rect.h - rect.h / 4},
 				   (mu_Vec2){rect.x + rect.w - rect.w / 5, rect.y + rect.h / 5}, 1,
-				   color);
+				   color, clip);
 		break;
 	}
 }
@@ -829,8 +1144,14 @@ static int renderer_get_text_width(mu_Font f, const char *text, int len)
 	struct text_width_cache_entry *entry = &text_width_cache[cache_idx];
 
 	if (entry->font == font && entry->hash == hash && entry->len == len) {
+#ifdef CONFIG_MICROUI_RENDER_STATS
+		frame_counters[0].stats.text_width_hits++;
+#endif /* CONFIG_MICROUI_RENDER_STATS */
 		return entry->width;
 	}
+#ifdef CONFIG_MICROUI_RENDER_STATS
+	frame_counters[0].stats.text_width_misses++;
+#endif /* CONFIG_MICROUI_RENDER_STATS */
 #endif /* CONFIG_MICROUI_TEXT_WIDTH_CACHE */
 
 	const char *current = text;
@@ -844,7 +1165,7 @@ static int renderer_get_text_width(mu_Font f, const char *text, int len)
 
 		const struct mu_FontGlyph *glyph = find_glyph(font, codepoint);
 		if (likely(glyph)) {
-			width += glyph->width;
+			width += glyph->advance;
 #ifdef CONFIG_MICROUI_FONT_KERNING
 			if (has_prev_codepoint) {
 				width += find_kerning_adjustment(font, prev_codepoint, codepoint);
@@ -887,20 +1208,23 @@ static int renderer_get_text_height(mu_Font f)
 
 static void renderer_set_clip_rect(mu_Rect rect)
 {
-	static mu_Rect screen_rect = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
-	clip_rect = intersect_rects(rect, screen_rect);
+	clip_rect = intersect_rects(rect, RENDER_RECT);
 }
 
 #ifdef CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW
 static void renderer_clear(mu_Color color)
 {
 	uint32_t pixel = color_to_pixel(color);
+	mu_Rect area = RENDER_RECT;
+
 	for (int x = 0; x < DISPLAY_WIDTH; x++) {
-		set_pixel_unchecked(x, 0, pixel);
+		set_pixel_unchecked(x, area.y, pixel);
 	}
-	uint8_t *src_row = display_buffer;
+	uint8_t *src_row = display_buffer + area.y * DISPLAY_STRIDE;
 	int row_bytes = DISPLAY_WIDTH * DISPLAY_BYTES_PER_PIXEL;
-	for (int y = 1; y < DISPLAY_HEIGHT; y++) {
+
+	STATS_PIXELS((area.h - 1) * DISPLAY_WIDTH);
+	for (int y = 1; y < area.h; y++) {
 		uint8_t *dst_row = src_row + (y * DISPLAY_STRIDE);
 		memcpy(dst_row, src_row, row_bytes);
 	}
@@ -916,7 +1240,10 @@ static void renderer_present(void)
 		.pitch = DISPLAY_WIDTH,
 		.frame_incomplete = false,
 	};
+
+	MU_TRACE(present_begin, 0, 0);
 	display_write(display_dev, 0, 0, &desc, display_buffer);
+	MU_TRACE(present_end, 0, 0);
 }
 
 #ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
@@ -966,10 +1293,10 @@ static __always_inline mu_Color pixel_to_color(const uint8_t *src, int offset,
 	return color;
 }
 
-static void renderer_draw_arc(mu_Vec2 center, int radius, int thickness, mu_Real start_angle,
-			      mu_Real end_angle, mu_Color color)
+static __always_inline void draw_arc(mu_Vec2 center, int radius, int thickness,
+				     mu_Real start_angle, mu_Real end_angle, uint32_t pixel,
+				     bool clip)
 {
-	uint32_t pixel = color_to_pixel(color);
 	int cx = center.x;
 	int cy = center.y;
 
@@ -1015,35 +1342,35 @@ static void renderer_draw_arc(mu_Vec2 center, int radius, int thickness, mu_Real
 			 */
 			/* Octant 1: 0° - 45° (3 o'clock going down-right) */
 			if (full || ((ratio >= a_start && ratio < a_end) ^ inverted)) {
-				set_pixel(cx + y, cy + x, pixel);
+				plot_pixel(cx + y, cy + x, pixel, clip);
 			}
 			/* Octant 2: 45° - 90° */
 			if (full || ((ratio > (63 - a_end) && ratio <= (63 - a_start)) ^ inverted)) {
-				set_pixel(cx + x, cy + y, pixel);
+				plot_pixel(cx + x, cy + y, pixel, clip);
 			}
 			/* Octant 3: 90° - 135° */
 			if (full || ((ratio >= (a_start - 64) && ratio < (a_end - 64)) ^ inverted)) {
-				set_pixel(cx - x, cy + y, pixel);
+				plot_pixel(cx - x, cy + y, pixel, clip);
 			}
 			/* Octant 4: 135° - 180° */
 			if (full || ((ratio > (127 - a_end) && ratio <= (127 - a_start)) ^ inverted)) {
-				set_pixel(cx - y, cy + x, pixel);
+				plot_pixel(cx - y, cy + x, pixel, clip);
 			}
 			/* Octant 5: 180° - 225° */
 			if (full || ((ratio >= (a_start - 128) && ratio < (a_end - 128)) ^ inverted)) {
-				set_pixel(cx - y, cy - x, pixel);
+				plot_pixel(cx - y, cy - x, pixel, clip);
 			}
 			/* Octant 6: 225° - 270° */
 			if (full || ((ratio > (191 - a_end) && ratio <= (191 - a_start)) ^ inverted)) {
-				set_pixel(cx - x, cy - y, pixel);
+				plot_pixel(cx - x, cy - y, pixel, clip);
 			}
 			/* Octant 7: 270° - 315° */
 			if (full || ((ratio >= (a_start - 192) && ratio < (a_end - 192)) ^ inverted)) {
-				set_pixel(cx + x, cy - y, pixel);
+				plot_pixel(cx + x, cy - y, pixel, clip);
 			}
 			/* Octant 8: 315° - 360° */
 			if (full || ((ratio > (255 - a_end) && ratio <= (255 - a_start)) ^ inverted)) {
-				set_pixel(cx + y, cy - x, pixel);
+				plot_pixel(cx + y, cy - x, pixel, clip);
 			}
 
 			/* Run Andres circle algorithm to get to the next pixel */
@@ -1062,9 +1389,20 @@ static void renderer_draw_arc(mu_Vec2 center, int radius, int thickness, mu_Real
 	}
 }
 
-static void renderer_draw_circle(mu_Vec2 center, int radius, mu_Color color)
+static void renderer_draw_arc(mu_Vec2 center, int radius, int thickness, mu_Real start_angle,
+			      mu_Real end_angle, mu_Color color, bool clip)
 {
 	uint32_t pixel = color_to_pixel(color);
+
+	if (clip) {
+		draw_arc(center, radius, thickness, start_angle, end_angle, pixel, true);
+	} else {
+		draw_arc(center, radius, thickness, start_angle, end_angle, pixel, false);
+	}
+}
+
+static __always_inline void draw_circle(mu_Vec2 center, int radius, uint32_t pixel, bool clip)
+{
 	int cx = center.x;
 	int cy = center.y;
 
@@ -1074,14 +1412,10 @@ static void renderer_draw_circle(mu_Vec2 center, int radius, mu_Color color)
 
 	while (x >= y) {
 		// For each "row band" of y, draw horizontal spans across the circle
-		for (int i = cx - x; i <= cx + x; i++) {
-			set_pixel(i, cy + y, pixel);
-			set_pixel(i, cy - y, pixel);
-		}
-		for (int i = cx - y; i <= cx + y; i++) {
-			set_pixel(i, cy + x, pixel);
-			set_pixel(i, cy - x, pixel);
-		}
+		draw_hspan(cx - x, cx + x, cy + y, pixel, clip);
+		draw_hspan(cx - x, cx + x, cy - y, pixel, clip);
+		draw_hspan(cx - y, cx + y, cy + x, pixel, clip);
+		draw_hspan(cx - y, cx + y, cy - x, pixel, clip);
 
 		y++;
 		if (err < 0) {
@@ -1093,7 +1427,35 @@ static void renderer_draw_circle(mu_Vec2 center, int radius, mu_Color color)
 	}
 }
 
-static void renderer_draw_image(mu_Vec2 pos, mu_Image image)
+static void renderer_draw_circle(mu_Vec2 center, int radius, mu_Color color, bool clip)
+{
+	uint32_t pixel = color_to_pixel(color);
+
+	if (clip) {
+		draw_circle(center, radius, pixel, true);
+	} else {
+		draw_circle(center, radius, pixel, false);
+	}
+}
+
+/* Get len bytes of image data, starting first bytes into row y */
+static __always_inline const uint8_t *image_span(const struct mu_ImageDescriptor *img_desc, int y,
+						 int first, int len)
+{
+	uint32_t offset = y * img_desc->stride + first;
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	if (img_desc->storage) {
+		return mu_asset_fetch(img_desc->storage, (uintptr_t)img_desc->data + offset, len);
+	}
+#else
+	ARG_UNUSED(len);
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+
+	return img_desc->data + offset;
+}
+
+static void renderer_draw_image(mu_Vec2 pos, mu_Image image, bool clip)
 {
 	if (image == NULL) {
 		return;
@@ -1101,17 +1463,24 @@ static void renderer_draw_image(mu_Vec2 pos, mu_Image image)
 
 	const struct mu_ImageDescriptor *img_desc = (const struct mu_ImageDescriptor *)image;
 
-	/* Validate image descriptor */
-	if (img_desc->data == NULL || img_desc->width == 0 || img_desc->height == 0) {
+	/* Validate image descriptor, with a storage data is an offset and may be 0 */
+	bool has_data = img_desc->data != NULL;
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	has_data = has_data || img_desc->storage != NULL;
+#endif
+	if (!has_data || img_desc->width == 0 || img_desc->height == 0) {
 		return;
 	}
 
 	/* Calculate visible region by intersecting image rect with display bounds */
 	mu_Rect img_rect = mu_rect(pos.x, pos.y, img_desc->width, img_desc->height);
-	mu_Rect display_rect = mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	mu_Rect display_rect = RENDER_RECT;
 	mu_Rect visible = intersect_rects(img_rect, display_rect);
 
-	visible = intersect_rects(visible, clip_rect);
+	if (clip) {
+		visible = intersect_rects(visible, clip_rect);
+	}
 
 	/* Early exit if completely clipped */
 	if (visible.w == 0 || visible.h == 0) {
@@ -1126,21 +1495,28 @@ static void renderer_draw_image(mu_Vec2 pos, mu_Image image)
 	if (img_desc->pixel_format == PIXEL_FORMAT_MONO01 ||
 	    img_desc->pixel_format == PIXEL_FORMAT_MONO10) {
 		bool invert = (img_desc->pixel_format == PIXEL_FORMAT_MONO10);
+		int first_byte = src_x_start / 8;
+		int span_len = (src_x_start + visible.w - 1) / 8 - first_byte + 1;
 
 		for (int row = 0; row < visible.h; row++) {
 			int src_y = src_y_start + row;
 			int dst_y = visible.y + row;
+			const uint8_t *src = image_span(img_desc, src_y, first_byte, span_len);
+
+			if (src == NULL) {
+				continue;
+			}
 
 			for (int col = 0; col < visible.w; col++) {
 				int src_x = src_x_start + col;
 				int dst_x = visible.x + col;
 
 				/* Calculate bit position in source data */
-				int byte_idx = src_y * img_desc->stride + (src_x / 8);
+				int byte_idx = src_x / 8 - first_byte;
 				int bit_idx = 7 - (src_x % 8);
 
 				/* Extract bit value */
-				uint8_t bit_val = (img_desc->data[byte_idx] >> bit_idx) & 0x01;
+				uint8_t bit_val = (src[byte_idx] >> bit_idx) & 0x01;
 
 				/* Apply inversion if MONO10 */
 				if (invert) {
@@ -1169,34 +1545,46 @@ static void renderer_draw_image(mu_Vec2 pos, mu_Image image)
 
 	if (format_matches) {
 		/* Fast path: direct memcpy when formats match */
+		int bytes_to_copy = visible.w * DISPLAY_BYTES_PER_PIXEL;
+
 		for (int row = 0; row < visible.h; row++) {
 			int src_y = src_y_start + row;
 			int dst_y = visible.y + row;
 
 			/* Calculate source and destination offsets */
-			const uint8_t *src = img_desc->data +
-					     (src_y * img_desc->stride) +
-					     (src_x_start * DISPLAY_BYTES_PER_PIXEL);
+			const uint8_t *src = image_span(img_desc, src_y,
+							src_x_start * DISPLAY_BYTES_PER_PIXEL,
+							bytes_to_copy);
 			uint8_t *dst = display_buffer +
 				       (dst_y * DISPLAY_STRIDE) +
 				       (visible.x * DISPLAY_BYTES_PER_PIXEL);
 
+			if (src == NULL) {
+				continue;
+			}
+
 			/* Copy row data */
-			int bytes_to_copy = visible.w * DISPLAY_BYTES_PER_PIXEL;
 			memcpy(dst, src, bytes_to_copy);
+			STATS_PIXELS(visible.w);
 		}
 	} else {
 		/* Slow path: format conversion needed - use set_pixel for each pixel */
+		int src_bpp = DISPLAY_BITS_PER_PIXEL(img_desc->pixel_format) / 8;
+
 		for (int row = 0; row < visible.h; row++) {
 			int src_y = src_y_start + row;
 			int dst_y = visible.y + row;
-			const uint8_t *src_row = img_desc->data + (src_y * img_desc->stride);
+			const uint8_t *src_row = image_span(img_desc, src_y, src_x_start * src_bpp,
+							    visible.w * src_bpp);
+
+			if (src_row == NULL) {
+				continue;
+			}
 
 			for (int col = 0; col < visible.w; col++) {
-				int src_x = src_x_start + col;
 				int dst_x = visible.x + col;
 
-				mu_Color color = pixel_to_color(src_row, src_x, img_desc->pixel_format);
+				mu_Color color = pixel_to_color(src_row, col, img_desc->pixel_format);
 				uint32_t pixel = color_to_pixel(color);
 				set_pixel_unchecked(dst_x, dst_y, pixel);
 			}
@@ -1204,7 +1592,8 @@ static void renderer_draw_image(mu_Vec2 pos, mu_Image image)
 	}
 }
 
-static void renderer_draw_triangle(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color color)
+static void renderer_draw_triangle(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color color,
+				   bool clip)
 {
 	uint32_t pixel = color_to_pixel(color);
 
@@ -1225,13 +1614,12 @@ static void renderer_draw_triangle(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color
 		p1 = tmp;
 	}
 
-	/* Calculate clipping bounds */
-	int clip_x_min, clip_x_max, clip_y_min, clip_y_max;
-
-	clip_x_min = clip_rect.x;
-	clip_x_max = clip_rect.x + clip_rect.w - 1;
-	clip_y_min = clip_rect.y;
-	clip_y_max = clip_rect.y + clip_rect.h - 1;
+	/* Calculate clipping bounds, unclipped triangles only need to stay on the display */
+	mu_Rect bounds = clip ? clip_rect : RENDER_RECT;
+	int clip_x_min = bounds.x;
+	int clip_x_max = bounds.x + bounds.w - 1;
+	int clip_y_min = bounds.y;
+	int clip_y_max = bounds.y + bounds.h - 1;
 
 	/* Early exit if triangle is completely outside clip bounds */
 	int tri_y_min = p0.y;
@@ -1251,9 +1639,7 @@ static void renderer_draw_triangle(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color
 		}
 		int min_x = mu_max(tri_x_min, clip_x_min);
 		int max_x = mu_min(tri_x_max, clip_x_max);
-		for (int x = min_x; x <= max_x; x++) {
-			set_pixel_unchecked(x, p0.y, pixel);
-		}
+		draw_hspan(min_x, max_x, p0.y, pixel, false);
 		return;
 	}
 
@@ -1294,89 +1680,657 @@ static void renderer_draw_triangle(mu_Vec2 p0, mu_Vec2 p1, mu_Vec2 p2, mu_Color
 		x_b = mu_min(x_b, clip_x_max);
 
 		/* Draw horizontal line from x_a to x_b */
-		for (int x = x_a; x <= x_b; x++) {
-			set_pixel_unchecked(x, y, pixel);
-		}
+		draw_hspan(x_a, x_b, y, pixel, false);
 	}
 }
 
 #endif
 
-void mu_set_bg_color(mu_Color color)
+#ifdef CONFIG_MICROUI_OCCLUSION_CULLING
+
+/* Removes the part of rect covered by occluder. The remainder is only representable as a
+ * rectangle when the occluder spans one full edge of rect, otherwise rect is kept as is.
+ */
+static mu_Rect subtract_rect(mu_Rect rect, mu_Rect occluder)
 {
-	bg_color = color;
+	mu_Rect overlap = intersect_rects(rect, occluder);
+
+	if (overlap.w == 0 || overlap.h == 0) {
+		return rect;
+	}
+	if (overlap.w == rect.w) {
+		if (overlap.h == rect.h) {
+			return mu_rect(rect.x, rect.y, 0, 0);
+		}
+		if (overlap.y == rect.y) {
+			rect.y += overlap.h;
+			rect.h -= overlap.h;
+		} else if (overlap.y + overlap.h == rect.y + rect.h) {
+			rect.h -= overlap.h;
+		}
+	} else if (overlap.h == rect.h) {
+		if (overlap.x == rect.x) {
+			rect.x += overlap.w;
+			rect.w -= overlap.w;
+		} else if (overlap.x + overlap.w == rect.x + rect.w) {
+			rect.w -= overlap.w;
+		}
+	}
+	return rect;
 }
 
-mu_Context *mu_get_context(void)
+static __always_inline void skip_command(mu_Command *cmd, mu_Command *next)
 {
-	return &mu_ctx;
+	cmd->type = MU_COMMAND_JUMP;
+	cmd->jump.dst = next;
 }
 
-void mu_render(void)
+/* Culls the commands of a single root container against the opaque containers above it */
+static void cull_container(mu_Container *cnt, const mu_Rect *occluders, int occluder_count)
 {
-#ifdef CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW
-	renderer_clear(bg_color);
-#endif /* CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW */
-	mu_Command *cmd = NULL;
-	while (mu_next_command(&mu_ctx, &cmd)) {
-		switch (cmd->type) {
-		case MU_COMMAND_TEXT:
-			renderer_draw_text(cmd->text.font, cmd->text.str, cmd->text.pos,
-					   cmd->text.color);
-			break;
-		case MU_COMMAND_RECT:
-			renderer_draw_rect(cmd->rect.rect, cmd->rect.color);
-			break;
-		case MU_COMMAND_ICON:
-			renderer_draw_icon(cmd->icon.id, cmd->icon.rect, cmd->icon.color);
-			break;
-		case MU_COMMAND_CLIP:
-			renderer_set_clip_rect(cmd->clip.rect);
-			break;
-#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
-		case MU_COMMAND_ARC:
-			renderer_draw_arc(cmd->arc.center, cmd->arc.radius, cmd->arc.thickness,
-					  cmd->arc.start_angle, cmd->arc.end_angle, cmd->arc.color);
-			break;
-		case MU_COMMAND_CIRCLE:
-			renderer_draw_circle(cmd->circle.center, cmd->circle.radius,
-					     cmd->circle.color);
-			break;
-		case MU_COMMAND_LINE:
-			renderer_draw_line(cmd->line.p0, cmd->line.p1, cmd->line.thickness,
-					   cmd->line.color);
-			break;
-		case MU_COMMAND_IMAGE:
-			renderer_draw_image(cmd->image.pos, cmd->image.image);
-			break;
-		case MU_COMMAND_TRIANGLE:
-			renderer_draw_triangle(cmd->triangle.p0, cmd->triangle.p1,
-					       cmd->triangle.p2, cmd->triangle.color);
-			break;
-#endif
+	mu_Rect unclipped = mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	mu_Rect clip = unclipped;
+	mu_Command *clip_cmd = NULL;
+	mu_Command *cmd = (mu_Command *)((char *)cnt->head + sizeof(mu_JumpCommand));
+
+	while (cmd != cnt->tail) {
+		mu_Command *next = (mu_Command *)((char *)cmd + cmd->base.size);
+
+		if (cmd->type == MU_COMMAND_JUMP) {
+			/* Nested root containers are skipped by their head jump */
+			clip_cmd = NULL;
+			cmd = cmd->jump.dst;
+			continue;
+		}
+
+		if (cmd->type == MU_COMMAND_CLIP) {
+			clip = intersect_rects(cmd->clip.rect, unclipped);
+			clip_cmd = cmd;
+			cmd = next;
+			continue;
+		}
+
+		/* A clip command only belongs to this draw if microui wrapped the draw with it */
+		if (next->type != MU_COMMAND_CLIP) {
+			clip_cmd = NULL;
+		}
+
+		mu_Rect visible = intersect_rects(mu_command_rect(&mu_ctx, cmd), clip);
+
+		for (int i = 0; i < occluder_count && visible.w > 0 && visible.h > 0; i++) {
+			visible = subtract_rect(visible, occluders[i]);
+		}
+
+		if (visible.w == 0 || visible.h == 0) {
+			/* Skip the clip command set up for this draw as well */
+			skip_command(clip_cmd ? clip_cmd : cmd, next);
+		} else if (cmd->type == MU_COMMAND_RECT) {
+			/* Rects are pre-clipped by microui and can be shrunk directly */
+			cmd->rect.rect = visible;
+		} else if (clip_cmd) {
+			clip_cmd->clip.rect = visible;
 		}
+
+		clip_cmd = NULL;
+		cmd = next;
 	}
-	renderer_present();
 }
 
-bool mu_needs_redraw(void)
+/* Drops or shrinks draw commands hidden beneath opaque root containers. Returns true if
+ * the display is entirely covered by an opaque container.
+ */
+static bool cull_occluded_commands(void)
 {
-	static mu_Id previous_command_hash;
-	mu_Id current_command_hash =
-		mu_get_id(&mu_ctx, &mu_ctx.command_list.items, mu_ctx.command_list.idx);
+	mu_Rect display_rect = mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	mu_Rect occluders[MU_ROOTLIST_SIZE];
+	int occluder_count = 0;
+	bool covered = false;
 
-	if (current_command_hash == previous_command_hash) {
-		return false;
+	/* Root containers are sorted by zindex in mu_end(), walk them top to bottom */
+	for (int i = mu_ctx.root_list.idx - 1; i >= 0; i--) {
+		mu_Container *cnt = mu_ctx.root_list.items[i];
+
+		if (occluder_count > 0) {
+			cull_container(cnt, occluders, occluder_count);
+		}
+
+		if (cnt->opaque) {
+			/* The rect the frame was drawn at, cnt->rect may have moved since */
+			mu_Rect rect = intersect_rects(cnt->frame_rect, display_rect);
+
+			if (rect.w > 0 && rect.h > 0) {
+				occluders[occluder_count++] = rect;
+				covered |= (rect.w == DISPLAY_WIDTH && rect.h == DISPLAY_HEIGHT);
+			}
+		}
 	}
-	previous_command_hash = current_command_hash;
 
-	return true;
+	return covered;
+}
+
+#endif /* CONFIG_MICROUI_OCCLUSION_CULLING */
+
+void mu_set_bg_color(mu_Color color)
+{
+	bg_color = color;
+}
+
+mu_Context *mu_get_context(void)
+{
+	return &mu_ctx;
+}
+
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+
+/* Moving averages are kept scaled by 2^GOVERNOR_AVG_SHIFT */
+#define GOVERNOR_AVG_SHIFT	   3
+#define GOVERNOR_MAX_DIVISOR	   4
+/* Consecutive frames a condition must hold before the rate changes */
+#define GOVERNOR_HYSTERESIS_FRAMES 8
+
+static struct {
+	uint32_t update_avg;
+	uint32_t render_avg;
+	uint32_t present_avg;
+	uint32_t present_cyc;
+	uint8_t divisor;
+	uint8_t overloaded;
+	uint8_t underloaded;
+	bool animating;
+} governor = {
+	.divisor = 1,
+};
+
+static void governor_average(uint32_t *avg, uint32_t sample)
+{
+	*avg += sample - (*avg >> GOVERNOR_AVG_SHIFT);
+}
+
+static void governor_update(uint32_t update_cyc, uint32_t render_cyc, uint32_t present_cyc,
+			    bool animating)
+{
+	governor_average(&governor.update_avg, update_cyc);
+	governor_average(&governor.render_avg, render_cyc);
+	governor_average(&governor.present_avg, present_cyc);
+
+	/* Give animations the full rate again; the governor backs off should
+	 * they not fit.
+	 */
+	if (animating && !governor.animating) {
+		governor.divisor = 1;
+		governor.overloaded = 0;
+		governor.underloaded = 0;
+	}
+	governor.animating = animating;
+
+	uint64_t cost = ((uint64_t)governor.update_avg + governor.render_avg +
+			 governor.present_avg) >> GOVERNOR_AVG_SHIFT;
+	uint64_t budget = (uint64_t)frame_period_cyc * governor.divisor;
+	uint64_t lower_budget = (uint64_t)frame_period_cyc * (governor.divisor - 1);
+
+	/* Drop the rate when frames use more than 7/8 of their budget, leaving
+	 * time for other threads; raise it again only once they would use less
+	 * than 5/8 of the smaller budget.
+	 */
+	if (cost * 8 > budget * 7) {
+		governor.underloaded = 0;
+		if (governor.divisor < GOVERNOR_MAX_DIVISOR &&
+		    ++governor.overloaded >= GOVERNOR_HYSTERESIS_FRAMES) {
+			governor.divisor++;
+			governor.overloaded = 0;
+		}
+	} else if (cost * 8 < lower_budget * 5) {
+		governor.overloaded = 0;
+		if (++governor.underloaded >= GOVERNOR_HYSTERESIS_FRAMES) {
+			governor.divisor--;
+			governor.underloaded = 0;
+		}
+	} else {
+		governor.overloaded = 0;
+		governor.underloaded = 0;
+	}
+}
+
+void mu_get_frame_stats(struct mu_FrameStats *stats)
+{
+	stats->update_us = k_cyc_to_us_floor32(governor.update_avg >> GOVERNOR_AVG_SHIFT);
+	stats->render_us = k_cyc_to_us_floor32(governor.render_avg >> GOVERNOR_AVG_SHIFT);
+	stats->present_us = k_cyc_to_us_floor32(governor.present_avg >> GOVERNOR_AVG_SHIFT);
+	stats->target_period_us = k_cyc_to_us_floor32(frame_period_cyc * governor.divisor);
+	stats->rate_divisor = governor.divisor;
+	stats->missed_frames = mu_get_missed_frames();
+}
+
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+
+static void render_clear(bool clear)
+{
+#ifdef CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW
+	if (clear) {
+#ifdef CONFIG_MICROUI_RENDER_STATS
+		uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+#ifdef CONFIG_MICROUI_ACCEL
+		if (!accel_clear(bg_color)) {
+			renderer_clear(bg_color);
+		}
+#else
+		renderer_clear(bg_color);
+#endif /* CONFIG_MICROUI_ACCEL */
+#ifdef CONFIG_MICROUI_RENDER_STATS
+		counters->stats.clear_cycles += k_cycle_get_32() - start;
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+	}
+#endif /* CONFIG_MICROUI_RENDER_CLEAR_BEFORE_DRAW */
+	ARG_UNUSED(clear);
+}
+
+static void draw_command(mu_Command *cmd)
+{
+#ifdef CONFIG_MICROUI_ACCEL
+	/* Consecutive accelerated commands are submitted without waiting */
+	if (accel_draw(cmd)) {
+		return;
+	}
+#endif /* CONFIG_MICROUI_ACCEL */
+
+	switch (cmd->type) {
+	case MU_COMMAND_TEXT:
+		/* Glyphs are always bounded by the display, only the clip rect is optional */
+		renderer_draw_text(cmd->text.font, cmd->text.str, cmd->text.pos,
+				   cmd->text.color, cmd->text.clipped);
+		break;
+	case MU_COMMAND_RECT:
+		renderer_draw_rect(cmd->rect.rect, cmd->rect.color);
+		break;
+	case MU_COMMAND_ICON:
+		renderer_draw_icon(cmd->icon.id, cmd->icon.rect, cmd->icon.color,
+				   command_needs_clip(cmd, cmd->icon.clipped));
+		break;
+	case MU_COMMAND_CLIP:
+		renderer_set_clip_rect(cmd->clip.rect);
+		break;
+#ifdef CONFIG_MICROUI_DRAW_EXTENSIONS
+	case MU_COMMAND_ARC:
+		renderer_draw_arc(cmd->arc.center, cmd->arc.radius, cmd->arc.thickness,
+				  cmd->arc.start_angle, cmd->arc.end_angle, cmd->arc.color,
+				  command_needs_clip(cmd, cmd->arc.clipped));
+		break;
+	case MU_COMMAND_CIRCLE:
+		renderer_draw_circle(cmd->circle.center, cmd->circle.radius,
+				     cmd->circle.color,
+				     command_needs_clip(cmd, cmd->circle.clipped));
+		break;
+	case MU_COMMAND_LINE:
+		renderer_draw_line(cmd->line.p0, cmd->line.p1, cmd->line.thickness,
+				   cmd->line.color, command_needs_clip(cmd, cmd->line.clipped));
+		break;
+	case MU_COMMAND_IMAGE:
+		renderer_draw_image(cmd->image.pos, cmd->image.image, cmd->image.clipped);
+		break;
+	case MU_COMMAND_TRIANGLE:
+		renderer_draw_triangle(cmd->triangle.p0, cmd->triangle.p1,
+				       cmd->triangle.p2, cmd->triangle.color,
+				       cmd->triangle.clipped);
+		break;
+#endif
+	}
+}
+
+static void render_command(mu_Command *cmd)
+{
+	MU_TRACE_COMMAND(cmd_begin, cmd->type, 0);
+#ifdef CONFIG_MICROUI_RENDER_STATS
+	struct mu_CommandStats *cmd_stats = &counters->stats.commands[cmd->type];
+	uint32_t start = k_cycle_get_32();
+
+	counters->pixels = 0;
+	counters->blended = 0;
+	draw_command(cmd);
+
+	cmd_stats->count++;
+	cmd_stats->pixels += counters->pixels;
+	cmd_stats->blended += counters->blended;
+	cmd_stats->cycles += k_cycle_get_32() - start;
+#else
+	draw_command(cmd);
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+	MU_TRACE_COMMAND(cmd_end, cmd->type, 0);
+}
+
+/* Draw the command list, confined to the current band if the display is split */
+static void render_commands(bool clear)
+{
+	render_clear(clear);
+
+	mu_Command *cmd = NULL;
+	while (mu_next_command(&mu_ctx, &cmd)) {
+		render_command(cmd);
+	}
+
+#ifdef CONFIG_MICROUI_ACCEL
+	accel_sync();
+#endif /* CONFIG_MICROUI_ACCEL */
+}
+
+#ifdef CONFIG_MICROUI_RENDER_BANDS
+#define BAND_THREADS CONFIG_MICROUI_RENDER_BAND_THREADS
+
+static K_KERNEL_STACK_ARRAY_DEFINE(band_stacks, BAND_THREADS,
+				  CONFIG_MICROUI_RENDER_BAND_STACK_SIZE);
+static struct k_thread band_threads[BAND_THREADS];
+static struct k_sem band_start[BAND_THREADS];
+static K_SEM_DEFINE(band_done, 0, BAND_THREADS);
+
+/* Bands per frame, including the one drawn by the rendering thread */
+static int band_count = BAND_THREADS + 1;
+
+/* Frame the band threads are drawing, published by the band_start semaphores */
+static int frame_bands;
+static bool frame_clear;
+
+static inline int band_top(int band, int count)
+{
+	return DISPLAY_HEIGHT * band / count;
+}
+
+#ifdef CONFIG_MICROUI_RENDER_BINNING
+#if CONFIG_MICROUI_COMMANDLIST_SIZE <= UINT16_MAX
+typedef uint16_t bin_entry_t;
+#else
+typedef uint32_t bin_entry_t;
+#endif
+
+/* Commands intersecting a band, as offsets into the command list */
+struct render_bin {
+	bin_entry_t *entries;
+	int count;
+	int capacity;
+	/* Set if the arena share of the band was too small, it replays the whole list */
+	bool overflow;
+	/* Last clip command added, NULL for the band bounds */
+	mu_Command *clip;
+};
+
+static bin_entry_t bin_arena[CONFIG_MICROUI_RENDER_BIN_ENTRIES];
+static struct render_bin bins[BAND_THREADS + 1];
+
+static void bin_add(struct render_bin *bin, mu_Command *cmd)
+{
+	if (bin->count == bin->capacity) {
+		bin->overflow = true;
+		return;
+	}
+
+	bin->entries[bin->count++] = (char *)cmd - mu_ctx.command_list.items;
+}
+
+/* Rows a command may draw to. Bands span the display width, so text width is not needed */
+static void command_rows(mu_Command *cmd, int *y0, int *y1)
+{
+	mu_Rect rect;
+
+	if (cmd->type == MU_COMMAND_TEXT) {
+		rect = mu_rect(0, cmd->text.pos.y, 0, renderer_get_text_height(cmd->text.font));
+	} else {
+		rect = mu_command_rect(&mu_ctx, cmd);
+	}
+
+	*y0 = MAX(rect.y, 0);
+	*y1 = MIN(rect.y + rect.h, DISPLAY_HEIGHT) - 1;
+}
+
+/*
+ * Record which commands each band has to draw, so a band only replays its own
+ * commands instead of the whole list. Clip commands are added to a band
+ * before the first command drawn with them.
+ */
+static void bin_commands(int count)
+{
+	int capacity = ARRAY_SIZE(bin_arena) / count;
+
+	for (int band = 0; band < count; band++) {
+		bins[band] = (struct render_bin){
+			.entries = &bin_arena[band * capacity],
+			.capacity = capacity,
+		};
+	}
+
+	mu_Command *cmd = NULL;
+	mu_Command *clip = NULL;
+
+	while (mu_next_command(&mu_ctx, &cmd)) {
+		if (cmd->type == MU_COMMAND_CLIP) {
+			clip = cmd;
+			continue;
+		}
+
+		int y0, y1;
+
+		command_rows(cmd, &y0, &y1);
+		if (y0 > y1) {
+			continue;
+		}
+
+		for (int band = y0 * count / DISPLAY_HEIGHT;
+		     band < count && band_top(band, count) <= y1; band++) {
+			struct render_bin *bin = &bins[band];
+
+			if (band_top(band + 1, count) <= y0) {
+				continue;
+			}
+			if (bin->clip != clip) {
+				bin_add(bin, clip);
+				bin->clip = clip;
+			}
+			bin_add(bin, cmd);
+		}
+	}
+}
+#endif /* CONFIG_MICROUI_RENDER_BINNING */
+
+static void render_band(int band)
+{
+	band_rect = mu_rect(0, band_top(band, frame_bands), DISPLAY_WIDTH,
+			    band_top(band + 1, frame_bands) - band_top(band, frame_bands));
+	clip_rect = band_rect;
+#ifdef CONFIG_MICROUI_RENDER_STATS
+	counters = &frame_counters[band];
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+
+#ifdef CONFIG_MICROUI_RENDER_BINNING
+	const struct render_bin *bin = &bins[band];
+
+	if (frame_bands > 1 && !bin->overflow) {
+		render_clear(frame_clear);
+		for (int i = 0; i < bin->count; i++) {
+			render_command((mu_Command *)&mu_ctx.command_list.items[bin->entries[i]]);
+		}
+		return;
+	}
+#endif /* CONFIG_MICROUI_RENDER_BINNING */
+
+	render_commands(frame_clear);
+}
+
+static void band_thread(void *p1, void *p2, void *p3)
+{
+	int band = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&band_start[band - 1], K_FOREVER);
+		render_band(band);
+		k_sem_give(&band_done);
+	}
+}
+
+static void band_threads_start(void)
+{
+	static bool started;
+
+	if (started) {
+		return;
+	}
+	started = true;
+
+	for (int i = 0; i < BAND_THREADS; i++) {
+		k_sem_init(&band_start[i], 0, 1);
+		k_thread_create(&band_threads[i], band_stacks[i],
+				K_KERNEL_STACK_SIZEOF(band_stacks[i]), band_thread,
+				INT_TO_POINTER(i + 1), NULL, NULL,
+				CONFIG_MICROUI_RENDER_BAND_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&band_threads[i], "mu_band");
+	}
+}
+
+/* Split the display into horizontal bands, each replaying the command list */
+static void render_bands(bool clear)
+{
+	band_threads_start();
+
+	/* Bitmap frame buffers pack several pixels into a byte, draw them in one band */
+	bool mono = display_caps.current_pixel_format == PIXEL_FORMAT_MONO01 ||
+		    display_caps.current_pixel_format == PIXEL_FORMAT_MONO10;
+
+	frame_bands = mono ? 1 : band_count;
+	frame_clear = clear;
+
+#ifdef CONFIG_MICROUI_RENDER_BINNING
+	if (frame_bands > 1) {
+		bin_commands(frame_bands);
+	}
+#endif /* CONFIG_MICROUI_RENDER_BINNING */
+
+	for (int band = 1; band < frame_bands; band++) {
+		k_sem_give(&band_start[band - 1]);
+	}
+
+	render_band(0);
+
+	/* All bands must be complete before the frame is presented */
+	for (int band = 1; band < frame_bands; band++) {
+		k_sem_take(&band_done, K_FOREVER);
+	}
+}
+
+int mu_set_render_bands(int count)
+{
+	if (count < 1 || count > BAND_THREADS + 1) {
+		return -EINVAL;
+	}
+
+	band_count = count;
+	return 0;
+}
+#endif /* CONFIG_MICROUI_RENDER_BANDS */
+
+#ifdef CONFIG_MICROUI_RENDER_STATS
+/* Sum up the counters of all bands as the statistics of the frame just rendered */
+static void publish_render_stats(uint32_t render_cycles)
+{
+	struct mu_RenderStats stats = {0};
+
+	for (int i = 0; i < ARRAY_SIZE(frame_counters); i++) {
+		const struct mu_RenderStats *band = &frame_counters[i].stats;
+
+		for (int type = 0; type < MU_COMMAND_MAX; type++) {
+			stats.commands[type].count += band->commands[type].count;
+			stats.commands[type].pixels += band->commands[type].pixels;
+			stats.commands[type].blended += band->commands[type].blended;
+			stats.commands[type].cycles += band->commands[type].cycles;
+		}
+		stats.clear_cycles += band->clear_cycles;
+		stats.present_cycles += band->present_cycles;
+		stats.text_width_hits += band->text_width_hits;
+		stats.text_width_misses += band->text_width_misses;
+	}
+
+#ifdef CONFIG_MICROUI_ASSET_STORAGE
+	mu_asset_cache_counters(&stats.asset_cache_hits, &stats.asset_cache_misses);
+#endif /* CONFIG_MICROUI_ASSET_STORAGE */
+	stats.render_cycles = render_cycles;
+	memset(frame_counters, 0, sizeof(frame_counters));
+
+	k_spinlock_key_t key = k_spin_lock(&render_stats_lock);
+
+	render_stats = stats;
+	k_spin_unlock(&render_stats_lock, key);
+}
+
+void mu_get_render_stats(struct mu_RenderStats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&render_stats_lock);
+
+	*stats = render_stats;
+	k_spin_unlock(&render_stats_lock, key);
+}
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+
+void mu_render(void)
+{
+	bool covered = false;
+#ifdef CONFIG_MICROUI_RENDER_STATS
+	uint32_t render_start = k_cycle_get_32();
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+
+	MU_TRACE(render_begin, mu_ctx.command_list.idx, 0);
+
+#ifdef CONFIG_MICROUI_OCCLUSION_CULLING
+	covered = cull_occluded_commands();
+#endif /* CONFIG_MICROUI_OCCLUSION_CULLING */
+
+#ifdef CONFIG_MICROUI_RENDER_BANDS
+	render_bands(!covered);
+#else
+	render_commands(!covered);
+#endif /* CONFIG_MICROUI_RENDER_BANDS */
+
+	MU_TRACE(render_end, covered, 0);
+
+#if defined(CONFIG_MICROUI_FRAME_GOVERNOR) || defined(CONFIG_MICROUI_RENDER_STATS)
+	uint32_t present_start = k_cycle_get_32();
+
+	renderer_present();
+	uint32_t present_cyc = k_cycle_get_32() - present_start;
+
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+	governor.present_cyc = present_cyc;
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+#ifdef CONFIG_MICROUI_RENDER_STATS
+	frame_counters[0].stats.present_cycles = present_cyc;
+	publish_render_stats(k_cycle_get_32() - render_start);
+#endif /* CONFIG_MICROUI_RENDER_STATS */
+#else
+	renderer_present();
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR || CONFIG_MICROUI_RENDER_STATS */
+}
+
+bool mu_needs_redraw(void)
+{
+	static mu_Id previous_command_hash;
+	mu_Id current_command_hash =
+		mu_get_id(&mu_ctx, &mu_ctx.command_list.items, mu_ctx.command_list.idx);
+	bool changed = current_command_hash != previous_command_hash;
+
+	previous_command_hash = current_command_hash;
+	MU_TRACE(redraw, changed, current_command_hash);
+
+	return changed;
 }
 
 bool mu_handle_tick(void)
 {
+	bool active = false;
+	bool animating = false;
+	bool redraw = true;
+
+	MU_TRACE(frame_begin, 0, 0);
+
 #ifdef CONFIG_MICROUI_INPUT
-	mu_handle_input_events();
+	active = mu_handle_input_events();
 #endif /* CONFIG_MICROUI_INPUT */
 
 	/* Yield to allow the input thread to process any pending input events.
@@ -1385,60 +2339,271 @@ bool mu_handle_tick(void)
 	 */
 	k_yield();
 
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+	uint32_t update_start = k_cycle_get_32();
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+
 	if (frame_cb) {
 		frame_cb(&mu_ctx);
 	}
+	MU_TRACE(update_end, mu_ctx.command_list.idx, 0);
+
+#ifdef CONFIG_MICROUI_ANIMATIONS
+	animating = mu_anim_active(&mu_ctx);
+#endif /* CONFIG_MICROUI_ANIMATIONS */
+	active = active || animating;
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	mu_frame_active = active;
+#else
+	ARG_UNUSED(active);
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+	uint32_t render_start = k_cycle_get_32();
+
+	governor.present_cyc = 0;
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
 
 #ifdef CONFIG_MICROUI_LAZY_REDRAW
-	if (!mu_needs_redraw()) {
-		return false;
-	}
+	redraw = mu_needs_redraw();
 #endif /* CONFIG_MICROUI_LAZY_REDRAW */
 
-	mu_render();
+	if (redraw) {
+		mu_render();
+	}
+
+#ifdef CONFIG_MICROUI_INPUT_LATENCY
+	mu_input_latency_frame_end(redraw);
+#endif /* CONFIG_MICROUI_INPUT_LATENCY */
 
-	return true;
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+	governor_update(render_start - update_start,
+			k_cycle_get_32() - render_start - governor.present_cyc,
+			governor.present_cyc, animating);
+#else
+	ARG_UNUSED(animating);
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+
+	MU_TRACE(frame_end, redraw, active);
+
+	return redraw;
 }
 
 #ifdef CONFIG_MICROUI_EVENT_LOOP
 
-static void microui_loop_work(struct k_work *work)
+static void microui_loop_work(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(mu_loop_work, microui_loop_work);
+
+/* Cycle count at which the frame currently being processed was due */
+static uint32_t frame_deadline;
+static bool frame_deadline_valid;
+static atomic_t frames_missed;
+
+#ifdef CONFIG_MICROUI_FRAME_PACING_SYNC
+static atomic_t frame_sync_armed;
+/* Earliest cycle count at which a sync signal may start the next frame */
+static atomic_t frame_sync_earliest;
+
+static void frame_sync_arm(uint32_t earliest, k_timeout_t fallback)
+{
+	atomic_set(&frame_sync_earliest, (atomic_val_t)earliest);
+	atomic_set(&frame_sync_armed, 1);
+
+	/* Keeps the loop running at a reduced rate should the signal stop */
+	k_work_schedule_for_queue(&mu_work_queue, &mu_loop_work, fallback);
+}
+
+void mu_frame_sync_signal(void)
+{
+	if (!atomic_get(&frame_sync_armed)) {
+		return;
+	}
+
+	if ((int32_t)(k_cycle_get_32() - (uint32_t)atomic_get(&frame_sync_earliest)) < 0) {
+		return;
+	}
+
+	if (atomic_cas(&frame_sync_armed, 1, 0)) {
+		k_work_reschedule_for_queue(&mu_work_queue, &mu_loop_work, K_NO_WAIT);
+	}
+}
+#endif /* CONFIG_MICROUI_FRAME_PACING_SYNC */
+
+#ifdef CONFIG_MICROUI_FRAME_PACING_TE_GPIO
+static const struct gpio_dt_spec te_gpio = GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), te_gpios);
+static struct gpio_callback te_gpio_cb;
+
+static void te_gpio_handler(const struct device *port, struct gpio_callback *cb,
+			    gpio_port_pins_t pins)
+{
+	ARG_UNUSED(port);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(pins);
+
+	mu_frame_sync_signal();
+}
+
+static int te_gpio_init(void)
 {
-	int64_t current_time = k_uptime_get();
+	int ret;
+
+	if (!gpio_is_ready_dt(&te_gpio)) {
+		LOG_ERR("TE GPIO not ready");
+		return -ENODEV;
+	}
+
+	ret = gpio_pin_configure_dt(&te_gpio, GPIO_INPUT);
+	if (ret < 0) {
+		return ret;
+	}
 
-	mu_handle_tick();
+	gpio_init_callback(&te_gpio_cb, te_gpio_handler, BIT(te_gpio.pin));
+	ret = gpio_add_callback_dt(&te_gpio, &te_gpio_cb);
+	if (ret < 0) {
+		return ret;
+	}
 
-	int64_t render_time = k_uptime_get() - current_time;
-	int64_t wait_time = CONFIG_MICROUI_DISPLAY_REFRESH_PERIOD - render_time;
+	return gpio_pin_interrupt_configure_dt(&te_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+}
+#endif /* CONFIG_MICROUI_FRAME_PACING_TE_GPIO */
 
-	/* Ensure a minimum wait time of 1ms to prevent starving other threads
-	 * (e.g., the input thread) when rendering takes longer than the
-	 * configured refresh period.
+static void schedule_next_frame(void)
+{
+	uint32_t period = frame_period_cyc;
+	uint32_t now = k_cycle_get_32();
+	uint32_t late = now - frame_deadline;
+
+#ifdef CONFIG_MICROUI_FRAME_GOVERNOR
+	period *= governor.divisor;
+#endif /* CONFIG_MICROUI_FRAME_GOVERNOR */
+
+	/* Deadlines advance by whole periods from the previous one rather than
+	 * from the current time, so the frame rate does not drift. Periods that
+	 * were overrun are skipped and counted as missed. A frame requested to
+	 * run immediately ran ahead of its deadline, which then still applies.
 	 */
-	if (wait_time < 1) {
-		wait_time = 1;
+	if ((int32_t)late >= 0) {
+		if (late >= period) {
+			uint32_t skipped = late / period;
+
+			atomic_add(&frames_missed, (atomic_val_t)skipped);
+			frame_deadline += skipped * period;
+		}
+		frame_deadline += period;
 	}
 
-	k_work_schedule_for_queue(&mu_work_queue, k_work_delayable_from_work(work),
-				  K_MSEC(wait_time));
+#ifdef CONFIG_MICROUI_FRAME_PACING_SYNC
+	/* Start on the first sync edge past three quarters of the period, so
+	 * panel refresh rates slightly off the configured period still hit
+	 * every edge (or every n-th edge for longer periods).
+	 */
+	frame_sync_arm(frame_deadline - period / 4, K_CYC(frame_deadline - now + period));
+#else
+	k_work_schedule_for_queue(&mu_work_queue, &mu_loop_work, K_CYC(frame_deadline - now));
+#endif /* CONFIG_MICROUI_FRAME_PACING_SYNC */
 }
 
-static K_WORK_DELAYABLE_DEFINE(mu_loop_work, microui_loop_work);
+static void microui_loop_work(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+#ifdef CONFIG_MICROUI_FRAME_PACING_SYNC
+	/* The panel sets the phase: count the period from this sync edge */
+	atomic_set(&frame_sync_armed, 0);
+	frame_deadline_valid = false;
+#endif /* CONFIG_MICROUI_FRAME_PACING_SYNC */
+
+	if (!frame_deadline_valid) {
+		frame_deadline = k_cycle_get_32();
+		frame_deadline_valid = true;
+	}
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	atomic_set(&loop_idle, 0);
+	atomic_set(&frame_requested, 0);
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+
+	bool redrawn = mu_handle_tick();
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	/* Nothing changed and nothing is pending: stay idle until the input
+	 * callback or the application calls mu_request_frame(). A request racing
+	 * with going idle is seen either here or by mu_request_frame(), and only
+	 * one of them takes the loop out of idle again.
+	 */
+	if (!redrawn && !mu_frame_active && !atomic_get(&frame_requested)) {
+		atomic_set(&loop_idle, 1);
+		if (!atomic_get(&frame_requested) || !atomic_cas(&loop_idle, 1, 0)) {
+			frame_deadline_valid = false;
+			return;
+		}
+	}
+#else
+	ARG_UNUSED(redrawn);
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+
+	schedule_next_frame();
+}
 
 int mu_event_loop_start(void)
 {
 	__ASSERT(frame_cb, "Process frame callback not set!");
+	frame_period_cyc = k_ms_to_cyc_ceil32(CONFIG_MICROUI_DISPLAY_REFRESH_PERIOD);
+	frame_deadline_valid = false;
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	atomic_set(&loop_idle, 0);
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
 	k_work_queue_start(&mu_work_queue, mu_work_stack, K_KERNEL_STACK_SIZEOF(mu_work_stack),
 			   CONFIG_MICROUI_EVENT_LOOP_THREAD_PRIORITY, NULL);
-	k_work_submit_to_queue(&mu_work_queue, &mu_loop_work.work);
+	atomic_set(&mu_loop_running, 1);
+	k_work_schedule_for_queue(&mu_work_queue, &mu_loop_work, K_NO_WAIT);
 	return 0;
 }
 
 int mu_event_loop_stop(void)
 {
+	atomic_set(&mu_loop_running, 0);
 	return k_work_queue_stop(&mu_work_queue, K_FOREVER);
 }
 
+void mu_request_frame(void)
+{
+	if (!atomic_get(&mu_loop_running)) {
+		return;
+	}
+
+#ifdef CONFIG_MICROUI_EVENT_LOOP_TICKLESS
+	/* While a frame runs or is scheduled, the loop keeps its pace and runs
+	 * the next frame at its deadline. Only an idle loop is woken up.
+	 */
+	atomic_set(&frame_requested, 1);
+	if (!atomic_cas(&loop_idle, 1, 0)) {
+		return;
+	}
+
+#ifdef CONFIG_MICROUI_FRAME_PACING_SYNC
+	frame_sync_arm(k_cycle_get_32(), K_CYC(frame_period_cyc));
+#else
+	k_work_schedule_for_queue(&mu_work_queue, &mu_loop_work, K_NO_WAIT);
+#endif /* CONFIG_MICROUI_FRAME_PACING_SYNC */
+#endif /* CONFIG_MICROUI_EVENT_LOOP_TICKLESS */
+}
+
+void mu_request_frame_immediate(void)
+{
+	if (!atomic_get(&mu_loop_running)) {
+		return;
+	}
+
+	k_work_reschedule_for_queue(&mu_work_queue, &mu_loop_work, K_NO_WAIT);
+}
+
+uint32_t mu_get_missed_frames(void)
+{
+	return (uint32_t)atomic_get(&frames_missed);
+}
+
 #endif /* CONFIG_MICROUI_EVENT_LOOP */
 
 int mu_setup(mu_process_frame_cb cb)
@@ -1460,5 +2625,9 @@ int mu_setup(mu_process_frame_cb cb)
 	k_work_queue_init(&mu_work_queue);
 #endif /* CONFIG_MICROUI_EVENT_LOOP */
 
+#ifdef CONFIG_MICROUI_FRAME_PACING_TE_GPIO
+	return te_gpio_init();
+#else
 	return 0;
+#endif /* CONFIG_MICROUI_FRAME_PACING_TE_GPIO */
 }
@@ -2,211 +2,210 @@
  * Variable Width Bitmap Font Data
  * Generated from: Montserrat-Medium.ttf
  * Font size: 12 pixels
- * Bitmap size: 16x16 pixels
+ * Line height: 16 pixels
  * Average character width: 7.1 pixels
  * Character range: 32-127 (96 requested, 96 total)
- * Format: Variable width, 1 bit per pixel
+ * Format: Variable width, 1 bit per pixel, cropped to the inked pixels
  */
 
 #include <stdint.h>
 #include <microui/font.h>
 
 const uint8_t montserrat_12_bitmaps[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00, 0x7F, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0xFF, 0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x3C, 0x00, 0x52, 0x00, 0x50, 0x00, 0x50, 0x00, 0x3C, 0x00, 0x16, 0x00, 0x12, 0x00, 0xD6, 0x00, 0x7C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x52, 0x00, 0x92, 0x00, 0x94, 0x00, 0x75, 0x80, 0x0A, 0x40, 0x12, 0x40, 0x12, 0x40, 0x23, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x24, 0x00, 0x28, 0x00, 0x30, 0x00, 0x49, 0x00, 0x46, 0x00, 0x46, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x7C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x66, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xCC, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x3C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x84, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x10, 0x00, 0x30, 0x00, 0x24, 0x00, 0x44, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x40, 0x00, 0x78, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xC4, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x00, 0x40, 0x00, 0x5C, 0x00, 0x66, 0x00, 0x42, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xC4, 0x00, 0xC4, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x46, 0x00, 0x42, 0x00, 0x46, 0x00, 0x3C, 0x00, 0x46, 0x00, 0x42, 0x00, 0x46, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x44, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0x7A, 0x00, 0x02, 0x00, 0x04, 0x00, 0x4C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x60, 0x00, 0x70, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xCC, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x30, 0xC0, 0x2F, 0xA0, 0x49, 0x90, 0x50, 0x90, 0x50, 0x90, 0x50, 0x90, 0x49, 0x90, 0x4F, 0x60, 0x20, 0x00, 0x30, 0x80, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x00, 0x28, 0x00, 0x68, 0x00, 0x44, 0x00, 0xC4, 0x00, 0xFE, 0x00, 0x82, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x7E, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x43, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x43, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44, 0x00, 0x48, 0x00, 0x58, 0x00, 0x7C, 0x00, 0x66, 0x00, 0x42, 0x00, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x60, 0xC0, 0x70, 0xC0, 0x51, 0x40, 0x49, 0x40, 0x4A, 0x40, 0x46, 0x40, 0x44, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x51, 0x00, 0x59, 0x00, 0x4D, 0x00, 0x45, 0x00, 0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0xC0, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x21, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0xC0, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x06, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x7E, 0x00, 0x46, 0x00, 0x42, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x42, 0x00, 0x40, 0x00, 0x60, 0x00, 0x3C, 0x00, 0x06, 0x00, 0x02, 0x00, 0xC6, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x61, 0x00, 0x23, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x82, 0x00, 0x86, 0x00, 0xC4, 0x00, 0x44, 0x00, 0x68, 0x00, 0x28, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x08, 0x43, 0x08, 0x47, 0x10, 0x65, 0x10, 0x24, 0x90, 0x2C, 0xA0, 0x38, 0xA0, 0x18, 0x60, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x24, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x24, 0x00, 0x62, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x84, 0x00, 0xC8, 0x00, 0x48, 0x00, 0x70, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x28, 0x00, 0x28, 0x00, 0x44, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x44, 0x00, 0x04, 0x00, 0x7C, 0x00, 0x44, 0x00, 0x44, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x5C, 0x00, 0x62, 0x00, 0x43, 0x00, 0x41, 0x00, 0x43, 0x00, 0x62, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x64, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x64, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x3A, 0x00, 0x66, 0x00, 0x42, 0x00, 0xC2, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x44, 0x00, 0x42, 0x00, 0xFE, 0x00, 0x40, 0x00, 0x64, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x60, 0x00, 0x40, 0x00, 0xF0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x66, 0x00, 0x42, 0x00, 0xC2, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3A, 0x00, 0x02, 0x00, 0x46, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x5C, 0x00, 0x66, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4C, 0x00, 0x58, 0x00, 0x78, 0x00, 0x6C, 0x00, 0x44, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xE0, 0x67, 0x20, 0x42, 0x30, 0x42, 0x30, 0x42, 0x30, 0x42, 0x30, 0x42, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x66, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x66, 0x00, 0x42, 0x00, 0xC2, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x62, 0x00, 0x43, 0x00, 0x41, 0x00, 0x43, 0x00, 0x62, 0x00, 0x5C, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x66, 0x00, 0x42, 0x00, 0xC2, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3A, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x48, 0x00, 0xC0, 0x00, 0x78, 0x00, 0x0C, 0x00, 0x8C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0xF0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x88, 0x00, 0x88, 0x00, 0xD0, 0x00, 0x50, 0x00, 0x70, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0x4C, 0x40, 0x4A, 0x40, 0x4A, 0x40, 0x32, 0x80, 0x31, 0x80, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x68, 0x00, 0x38, 0x00, 0x10, 0x00, 0x38, 0x00, 0x68, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0x50, 0x00, 0x50, 0x00, 0x60, 0x00, 0x20, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x08, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x80,
+    0xB6, 0x80,
+    0x12, 0x22, 0x7F, 0x24, 0x24, 0x24, 0xFF, 0x24, 0x24,
+    0x10, 0x20, 0xF2, 0x95, 0x0A, 0x0F, 0x0B, 0x13, 0xAD, 0xF0, 0x80,
+    0x71, 0x14, 0x89, 0x22, 0x50, 0x75, 0x82, 0x91, 0x24, 0x49, 0x23, 0x80,
+    0x70, 0x91, 0x22, 0x86, 0x12, 0x63, 0x46, 0x72,
+    0xE0,
+    0x69, 0x69, 0x24, 0x99, 0x26,
+    0xC9, 0x12, 0x49, 0x25, 0x2C,
+    0x27, 0xC9, 0xF2, 0x00,
+    0x21, 0x09, 0xF2, 0x10,
+    0xF0,
+    0xE0,
+    0xC0,
+    0x12, 0x22, 0x44, 0x48, 0x88,
+    0x7B, 0x38, 0x61, 0x86, 0x18, 0x73, 0x78,
+    0xE4, 0x92, 0x49, 0x20,
+    0x7B, 0x30, 0x41, 0x08, 0x63, 0x18, 0xFC,
+    0xFC, 0x31, 0x84, 0x3C, 0x10, 0x61, 0x78,
+    0x0C, 0x08, 0x10, 0x30, 0x24, 0x44, 0xFF, 0x04, 0x04,
+    0x7D, 0x04, 0x1E, 0x04, 0x10, 0x71, 0x78,
+    0x3F, 0x08, 0x2E, 0xCE, 0x18, 0x73, 0x78,
+    0xFF, 0x8B, 0x10, 0x60, 0x81, 0x04, 0x08, 0x30,
+    0x7A, 0x38, 0x63, 0x7A, 0x38, 0x63, 0x78,
+    0x78, 0x8B, 0x1E, 0x37, 0xA0, 0x41, 0x26, 0x78,
+    0xC6,
+    0xC7, 0x80,
+    0x09, 0xB1, 0xC1, 0x80,
+    0xF8, 0x01, 0xF0,
+    0x83, 0x06, 0x7C, 0x00,
+    0x7B, 0x30, 0x41, 0x08, 0x41, 0x00, 0x10,
+    0x1F, 0x0C, 0x31, 0x7D, 0x49, 0x9A, 0x13, 0x42, 0x68, 0x4C, 0x99, 0x9E, 0xC8, 0x01, 0x84, 0x0F, 0x00,
+    0x10, 0x38, 0x28, 0x68, 0x44, 0xC4, 0xFE, 0x82, 0x03,
+    0xFD, 0x0E, 0x0C, 0x1F, 0xD0, 0x60, 0xC1, 0xFE,
+    0x3C, 0x86, 0x04, 0x08, 0x10, 0x20, 0x21, 0x3C,
+    0xFC, 0x86, 0x81, 0x81, 0x81, 0x81, 0x81, 0x86, 0xFC,
+    0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0xFC,
+    0xFE, 0x08, 0x20, 0xFE, 0x08, 0x20, 0x80,
+    0x3C, 0x86, 0x04, 0x08, 0x30, 0x60, 0xA1, 0x3C,
+    0x83, 0x06, 0x0C, 0x1F, 0xF0, 0x60, 0xC1, 0x82,
+    0xFF, 0x80,
+    0xF1, 0x11, 0x11, 0x13, 0xE0,
+    0x82, 0x84, 0x88, 0x90, 0xB0, 0xF8, 0xCC, 0x84, 0x83,
+    0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0xFC,
+    0xC0, 0xE0, 0xF8, 0x74, 0x59, 0x2C, 0xA6, 0x33, 0x11, 0x80, 0x80,
+    0xC3, 0x86, 0x8D, 0x99, 0xB1, 0x61, 0xC3, 0x82,
+    0x3C, 0x21, 0x20, 0x50, 0x28, 0x1C, 0x0A, 0x04, 0x84, 0x3C, 0x00,
+    0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA0, 0x40, 0x80,
+    0x3C, 0x21, 0x20, 0x50, 0x28, 0x1C, 0x0A, 0x04, 0x84, 0x3C, 0x06, 0x41, 0xC0,
+    0xFD, 0x0E, 0x0C, 0x18, 0x7F, 0xA3, 0x42, 0x82,
+    0x3C, 0x85, 0x03, 0x03, 0xC0, 0xC0, 0xE3, 0x7C,
+    0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10,
+    0x83, 0x06, 0x0C, 0x18, 0x30, 0x70, 0xA3, 0x3C,
+    0x03, 0x82, 0x86, 0xC4, 0x44, 0x68, 0x28, 0x30, 0x30,
+    0xC3, 0x0A, 0x18, 0x51, 0xC4, 0xCA, 0x22, 0x49, 0x16, 0x50, 0xE2, 0x83, 0x0C, 0x18, 0x40,
+    0xC3, 0x66, 0x24, 0x18, 0x18, 0x18, 0x24, 0x62, 0xC3,
+    0x87, 0x0B, 0x22, 0x47, 0x06, 0x08, 0x10, 0x20,
+    0xFC, 0x18, 0x20, 0x83, 0x04, 0x10, 0x40, 0xFE,
+    0xF2, 0x49, 0x24, 0x92, 0x4E,
+    0x88, 0x88, 0x44, 0x42, 0x23,
+    0xE4, 0x92, 0x49, 0x24, 0x9E,
+    0x21, 0x14, 0xA8, 0xC4,
+    0xFC,
+    0xC3,
+    0xF4, 0x43, 0xF8, 0xC7, 0xE0,
+    0x81, 0x02, 0x05, 0xCC, 0x50, 0xE0, 0xC3, 0xC5, 0x70,
+    0x3D, 0x94, 0x30, 0x41, 0x93, 0xC0,
+    0x02, 0x04, 0x09, 0xD6, 0x68, 0x70, 0xA1, 0x66, 0x74,
+    0x38, 0x89, 0x0F, 0xF4, 0x0C, 0x8F, 0x00,
+    0x36, 0x4F, 0x44, 0x44, 0x44,
+    0x3A, 0xCD, 0x0E, 0x14, 0x2C, 0xCE, 0x81, 0x46, 0x78,
+    0x82, 0x08, 0x2E, 0xCE, 0x18, 0x61, 0x86, 0x10,
+    0x9F, 0xC0,
+    0xC2, 0xAA, 0xAA, 0x80,
+    0x82, 0x08, 0x23, 0x9A, 0xCF, 0x36, 0x8A, 0x10,
+    0xFF, 0xC0,
+    0xBB, 0xD9, 0xCA, 0x11, 0xC2, 0x38, 0x47, 0x08, 0xE1, 0x18,
+    0xBB, 0x38, 0x61, 0x86, 0x18, 0x40,
+    0x3C, 0xCD, 0x0E, 0x14, 0x2C, 0xCF, 0x00,
+    0xB9, 0x8A, 0x1C, 0x18, 0x78, 0xAE, 0x40, 0x81, 0x00,
+    0x3A, 0xCD, 0x0E, 0x14, 0x2C, 0xCE, 0x81, 0x02, 0x04,
+    0xBC, 0x88, 0x88, 0x80,
+    0x79, 0x2C, 0x1E, 0x0E, 0x37, 0x80,
+    0x42, 0x3C, 0x84, 0x21, 0x0C, 0x38,
+    0x86, 0x18, 0x61, 0x87, 0x37, 0x40,
+    0x0E, 0x28, 0xB4, 0x51, 0xC2, 0x00,
+    0x84, 0x29, 0x89, 0x29, 0x25, 0x23, 0x28, 0x63, 0x0C, 0x60,
+    0xC5, 0xA3, 0x84, 0x39, 0xAC, 0x40,
+    0x0E, 0x28, 0xA4, 0x51, 0x46, 0x08, 0x43, 0x00,
+    0x7C, 0x21, 0x0C, 0x21, 0x0F, 0xC0,
+    0x69, 0x24, 0xA2, 0x49, 0x26,
+    0xFF, 0xF8,
+    0xC6, 0x66, 0x66, 0x36, 0x66, 0x66, 0xC0,
+    0xED, 0xC0,
+    0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xFE,
 };
 
 const struct mu_FontGlyph montserrat_12_glyphs[] = {
-    {32u,  4, 16, &montserrat_12_bitmaps[0]}, // Space (width: 4)
-    {33u,  3, 16, &montserrat_12_bitmaps[32]}, // '!' (width: 3)
-    {34u,  5, 16, &montserrat_12_bitmaps[64]}, // '"' (width: 5)
-    {35u,  8, 16, &montserrat_12_bitmaps[96]}, // '#' (width: 8)
-    {36u,  7, 16, &montserrat_12_bitmaps[128]}, // '$' (width: 7)
-    {37u, 10, 16, &montserrat_12_bitmaps[160]}, // '%' (width: 10)
-    {38u,  8, 16, &montserrat_12_bitmaps[192]}, // '&' (width: 8)
-    {39u,  3, 16, &montserrat_12_bitmaps[224]}, // "'" (width: 3)
-    {40u,  4, 16, &montserrat_12_bitmaps[256]}, // '(' (width: 4)
-    {41u,  4, 16, &montserrat_12_bitmaps[288]}, // ')' (width: 4)
-    {42u,  5, 16, &montserrat_12_bitmaps[320]}, // '*' (width: 5)
-    {43u,  7, 16, &montserrat_12_bitmaps[352]}, // '+' (width: 7)
-    {44u,  3, 16, &montserrat_12_bitmaps[384]}, // ',' (width: 3)
-    {45u,  5, 16, &montserrat_12_bitmaps[416]}, // '-' (width: 5)
-    {46u,  3, 16, &montserrat_12_bitmaps[448]}, // '.' (width: 3)
-    {47u,  4, 16, &montserrat_12_bitmaps[480]}, // '/' (width: 4)
-    {48u,  8, 16, &montserrat_12_bitmaps[512]}, // '0' (width: 8)
-    {49u,  4, 16, &montserrat_12_bitmaps[544]}, // '1' (width: 4)
-    {50u,  7, 16, &montserrat_12_bitmaps[576]}, // '2' (width: 7)
-    {51u,  7, 16, &montserrat_12_bitmaps[608]}, // '3' (width: 7)
-    {52u,  8, 16, &montserrat_12_bitmaps[640]}, // '4' (width: 8)
-    {53u,  7, 16, &montserrat_12_bitmaps[672]}, // '5' (width: 7)
-    {54u,  7, 16, &montserrat_12_bitmaps[704]}, // '6' (width: 7)
-    {55u,  7, 16, &montserrat_12_bitmaps[736]}, // '7' (width: 7)
-    {56u,  8, 16, &montserrat_12_bitmaps[768]}, // '8' (width: 8)
-    {57u,  7, 16, &montserrat_12_bitmaps[800]}, // '9' (width: 7)
-    {58u,  3, 16, &montserrat_12_bitmaps[832]}, // ':' (width: 3)
-    {59u,  3, 16, &montserrat_12_bitmaps[864]}, // ';' (width: 3)
-    {60u,  7, 16, &montserrat_12_bitmaps[896]}, // '<' (width: 7)
-    {61u,  7, 16, &montserrat_12_bitmaps[928]}, // '=' (width: 7)
-    {62u,  7, 16, &montserrat_12_bitmaps[960]}, // '>' (width: 7)
-    {63u,  7, 16, &montserrat_12_bitmaps[992]}, // '?' (width: 7)
-    {64u, 12, 16, &montserrat_12_bitmaps[1024]}, // '@' (width: 12)
-    {65u,  9, 16, &montserrat_12_bitmaps[1056]}, // 'A' (width: 9)
-    {66u,  9, 16, &montserrat_12_bitmaps[1088]}, // 'B' (width: 9)
-    {67u,  9, 16, &montserrat_12_bitmaps[1120]}, // 'C' (width: 9)
-    {68u, 10, 16, &montserrat_12_bitmaps[1152]}, // 'D' (width: 10)
-    {69u,  8, 16, &montserrat_12_bitmaps[1184]}, // 'E' (width: 8)
-    {70u,  8, 16, &montserrat_12_bitmaps[1216]}, // 'F' (width: 8)
-    {71u,  9, 16, &montserrat_12_bitmaps[1248]}, // 'G' (width: 9)
-    {72u, 10, 16, &montserrat_12_bitmaps[1280]}, // 'H' (width: 10)
-    {73u,  4, 16, &montserrat_12_bitmaps[1312]}, // 'I' (width: 4)
-    {74u,  6, 16, &montserrat_12_bitmaps[1344]}, // 'J' (width: 6)
-    {75u,  9, 16, &montserrat_12_bitmaps[1376]}, // 'K' (width: 9)
-    {76u,  7, 16, &montserrat_12_bitmaps[1408]}, // 'L' (width: 7)
-    {77u, 11, 16, &montserrat_12_bitmaps[1440]}, // 'M' (width: 11)
-    {78u, 10, 16, &montserrat_12_bitmaps[1472]}, // 'N' (width: 10)
-    {79u, 10, 16, &montserrat_12_bitmaps[1504]}, // 'O' (width: 10)
-    {80u,  9, 16, &montserrat_12_bitmaps[1536]}, // 'P' (width: 9)
-    {81u, 10, 16, &montserrat_12_bitmaps[1568]}, // 'Q' (width: 10)
-    {82u,  9, 16, &montserrat_12_bitmaps[1600]}, // 'R' (width: 9)
-    {83u,  7, 16, &montserrat_12_bitmaps[1632]}, // 'S' (width: 7)
-    {84u,  7, 16, &montserrat_12_bitmaps[1664]}, // 'T' (width: 7)
-    {85u,  9, 16, &montserrat_12_bitmaps[1696]}, // 'U' (width: 9)
-    {86u,  9, 16, &montserrat_12_bitmaps[1728]}, // 'V' (width: 9)
-    {87u, 14, 16, &montserrat_12_bitmaps[1760]}, // 'W' (width: 14)
-    {88u,  8, 16, &montserrat_12_bitmaps[1792]}, // 'X' (width: 8)
-    {89u,  8, 16, &montserrat_12_bitmaps[1824]}, // 'Y' (width: 8)
-    {90u,  8, 16, &montserrat_12_bitmaps[1856]}, // 'Z' (width: 8)
-    {91u,  4, 16, &montserrat_12_bitmaps[1888]}, // '[' (width: 4)
-    {92u,  4, 16, &montserrat_12_bitmaps[1920]}, // '\\' (width: 4)
-    {93u,  4, 16, &montserrat_12_bitmaps[1952]}, // ']' (width: 4)
-    {94u,  7, 16, &montserrat_12_bitmaps[1984]}, // '^' (width: 7)
-    {95u,  6, 16, &montserrat_12_bitmaps[2016]}, // '_' (width: 6)
-    {96u,  7, 16, &montserrat_12_bitmaps[2048]}, // '`' (width: 7)
-    {97u,  7, 16, &montserrat_12_bitmaps[2080]}, // 'a' (width: 7)
-    {98u,  8, 16, &montserrat_12_bitmaps[2112]}, // 'b' (width: 8)
-    {99u,  7, 16, &montserrat_12_bitmaps[2144]}, // 'c' (width: 7)
-    {100u,  8, 16, &montserrat_12_bitmaps[2176]}, // 'd' (width: 8)
-    {101u,  7, 16, &montserrat_12_bitmaps[2208]}, // 'e' (width: 7)
-    {102u,  4, 16, &montserrat_12_bitmaps[2240]}, // 'f' (width: 4)
-    {103u,  8, 16, &montserrat_12_bitmaps[2272]}, // 'g' (width: 8)
-    {104u,  8, 16, &montserrat_12_bitmaps[2304]}, // 'h' (width: 8)
-    {105u,  3, 16, &montserrat_12_bitmaps[2336]}, // 'i' (width: 3)
-    {106u,  3, 16, &montserrat_12_bitmaps[2368]}, // 'j' (width: 3)
-    {107u,  7, 16, &montserrat_12_bitmaps[2400]}, // 'k' (width: 7)
-    {108u,  3, 16, &montserrat_12_bitmaps[2432]}, // 'l' (width: 3)
-    {109u, 13, 16, &montserrat_12_bitmaps[2464]}, // 'm' (width: 13)
-    {110u,  8, 16, &montserrat_12_bitmaps[2496]}, // 'n' (width: 8)
-    {111u,  8, 16, &montserrat_12_bitmaps[2528]}, // 'o' (width: 8)
-    {112u,  8, 16, &montserrat_12_bitmaps[2560]}, // 'p' (width: 8)
-    {113u,  8, 16, &montserrat_12_bitmaps[2592]}, // 'q' (width: 8)
-    {114u,  5, 16, &montserrat_12_bitmaps[2624]}, // 'r' (width: 5)
-    {115u,  6, 16, &montserrat_12_bitmaps[2656]}, // 's' (width: 6)
-    {116u,  5, 16, &montserrat_12_bitmaps[2688]}, // 't' (width: 5)
-    {117u,  8, 16, &montserrat_12_bitmaps[2720]}, // 'u' (width: 8)
-    {118u,  7, 16, &montserrat_12_bitmaps[2752]}, // 'v' (width: 7)
-    {119u, 11, 16, &montserrat_12_bitmaps[2784]}, // 'w' (width: 11)
-    {120u,  7, 16, &montserrat_12_bitmaps[2816]}, // 'x' (width: 7)
-    {121u,  7, 16, &montserrat_12_bitmaps[2848]}, // 'y' (width: 7)
-    {122u,  6, 16, &montserrat_12_bitmaps[2880]}, // 'z' (width: 6)
-    {123u,  4, 16, &montserrat_12_bitmaps[2912]}, // '{' (width: 4)
-    {124u,  4, 16, &montserrat_12_bitmaps[2944]}, // '|' (width: 4)
-    {125u,  4, 16, &montserrat_12_bitmaps[2976]}, // '}' (width: 4)
-    {126u,  7, 16, &montserrat_12_bitmaps[3008]}, // '~' (width: 7)
-    {127u,  7, 16, &montserrat_12_bitmaps[3040]} // \x7F (width: 7)
+    {32u,  4,  0,  0,  0,  0, &montserrat_12_bitmaps[0]}, // Space (advance: 4)
+    {33u,  3,  1,  9,  1,  3, &montserrat_12_bitmaps[0]}, // '!' (advance: 3)
+    {34u,  5,  3,  3,  1,  3, &montserrat_12_bitmaps[2]}, // '"' (advance: 5)
+    {35u,  8,  8,  9,  0,  3, &montserrat_12_bitmaps[4]}, // '#' (advance: 8)
+    {36u,  7,  7, 12,  0,  1, &montserrat_12_bitmaps[13]}, // '$' (advance: 7)
+    {37u, 10, 10,  9,  0,  3, &montserrat_12_bitmaps[24]}, // '%' (advance: 10)
+    {38u,  8,  7,  9,  1,  3, &montserrat_12_bitmaps[36]}, // '&' (advance: 8)
+    {39u,  3,  1,  3,  1,  3, &montserrat_12_bitmaps[44]}, // "'" (advance: 3)
+    {40u,  4,  3, 13,  1,  2, &montserrat_12_bitmaps[45]}, // '(' (advance: 4)
+    {41u,  4,  3, 13,  0,  2, &montserrat_12_bitmaps[50]}, // ')' (advance: 4)
+    {42u,  5,  5,  5,  0,  2, &montserrat_12_bitmaps[55]}, // '*' (advance: 5)
+    {43u,  7,  5,  6,  1,  4, &montserrat_12_bitmaps[59]}, // '+' (advance: 7)
+    {44u,  3,  1,  4,  1, 10, &montserrat_12_bitmaps[63]}, // ',' (advance: 3)
+    {45u,  5,  3,  1,  1,  8, &montserrat_12_bitmaps[64]}, // '-' (advance: 5)
+    {46u,  3,  1,  2,  1, 10, &montserrat_12_bitmaps[65]}, // '.' (advance: 3)
+    {47u,  4,  4, 10,  0,  0, &montserrat_12_bitmaps[66]}, // '/' (advance: 4)
+    {48u,  8,  6,  9,  1,  3, &montserrat_12_bitmaps[71]}, // '0' (advance: 8)
+    {49u,  4,  3,  9,  0,  3, &montserrat_12_bitmaps[78]}, // '1' (advance: 4)
+    {50u,  7,  6,  9,  0,  3, &montserrat_12_bitmaps[82]}, // '2' (advance: 7)
+    {51u,  7,  6,  9,  0,  3, &montserrat_12_bitmaps[89]}, // '3' (advance: 7)
+    {52u,  8,  8,  9,  0,  3, &montserrat_12_bitmaps[96]}, // '4' (advance: 8)
+    {53u,  7,  6,  9,  0,  3, &montserrat_12_bitmaps[105]}, // '5' (advance: 7)
+    {54u,  7,  6,  9,  1,  3, &montserrat_12_bitmaps[112]}, // '6' (advance: 7)
+    {55u,  7,  7,  9,  0,  3, &montserrat_12_bitmaps[119]}, // '7' (advance: 7)
+    {56u,  8,  6,  9,  1,  3, &montserrat_12_bitmaps[127]}, // '8' (advance: 8)
+    {57u,  7,  7,  9,  0,  3, &montserrat_12_bitmaps[134]}, // '9' (advance: 7)
+    {58u,  3,  1,  7,  1,  5, &montserrat_12_bitmaps[142]}, // ':' (advance: 3)
+    {59u,  3,  1,  9,  1,  5, &montserrat_12_bitmaps[143]}, // ';' (advance: 3)
+    {60u,  7,  5,  5,  1,  5, &montserrat_12_bitmaps[145]}, // '<' (advance: 7)
+    {61u,  7,  5,  4,  1,  5, &montserrat_12_bitmaps[149]}, // '=' (advance: 7)
+    {62u,  7,  5,  5,  1,  5, &montserrat_12_bitmaps[152]}, // '>' (advance: 7)
+    {63u,  7,  6,  9,  0,  3, &montserrat_12_bitmaps[156]}, // '?' (advance: 7)
+    {64u, 12, 11, 12,  1,  3, &montserrat_12_bitmaps[163]}, // '@' (advance: 12)
+    {65u,  9,  8,  9,  0,  3, &montserrat_12_bitmaps[180]}, // 'A' (advance: 9)
+    {66u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[189]}, // 'B' (advance: 9)
+    {67u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[197]}, // 'C' (advance: 9)
+    {68u, 10,  8,  9,  1,  3, &montserrat_12_bitmaps[205]}, // 'D' (advance: 10)
+    {69u,  8,  6,  9,  1,  3, &montserrat_12_bitmaps[214]}, // 'E' (advance: 8)
+    {70u,  8,  6,  9,  1,  3, &montserrat_12_bitmaps[221]}, // 'F' (advance: 8)
+    {71u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[228]}, // 'G' (advance: 9)
+    {72u, 10,  7,  9,  1,  3, &montserrat_12_bitmaps[236]}, // 'H' (advance: 10)
+    {73u,  4,  1,  9,  1,  3, &montserrat_12_bitmaps[244]}, // 'I' (advance: 4)
+    {74u,  6,  4,  9,  0,  3, &montserrat_12_bitmaps[246]}, // 'J' (advance: 6)
+    {75u,  9,  8,  9,  1,  3, &montserrat_12_bitmaps[251]}, // 'K' (advance: 9)
+    {76u,  7,  6,  9,  1,  3, &montserrat_12_bitmaps[260]}, // 'L' (advance: 7)
+    {77u, 11,  9,  9,  1,  3, &montserrat_12_bitmaps[267]}, // 'M' (advance: 11)
+    {78u, 10,  7,  9,  1,  3, &montserrat_12_bitmaps[278]}, // 'N' (advance: 10)
+    {79u, 10,  9,  9,  1,  3, &montserrat_12_bitmaps[286]}, // 'O' (advance: 10)
+    {80u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[297]}, // 'P' (advance: 9)
+    {81u, 10,  9, 11,  1,  3, &montserrat_12_bitmaps[305]}, // 'Q' (advance: 10)
+    {82u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[318]}, // 'R' (advance: 9)
+    {83u,  7,  7,  9,  0,  3, &montserrat_12_bitmaps[326]}, // 'S' (advance: 7)
+    {84u,  7,  7,  9,  0,  3, &montserrat_12_bitmaps[334]}, // 'T' (advance: 7)
+    {85u,  9,  7,  9,  1,  3, &montserrat_12_bitmaps[342]}, // 'U' (advance: 9)
+    {86u,  9,  8,  9,  0,  3, &montserrat_12_bitmaps[350]}, // 'V' (advance: 9)
+    {87u, 14, 13,  9,  0,  3, &montserrat_12_bitmaps[359]}, // 'W' (advance: 14)
+    {88u,  8,  8,  9,  0,  3, &montserrat_12_bitmaps[374]}, // 'X' (advance: 8)
+    {89u,  8,  7,  9,  0,  3, &montserrat_12_bitmaps[383]}, // 'Y' (advance: 8)
+    {90u,  8,  7,  9,  1,  3, &montserrat_12_bitmaps[391]}, // 'Z' (advance: 8)
+    {91u,  4,  3, 13,  1,  2, &montserrat_12_bitmaps[399]}, // '[' (advance: 4)
+    {92u,  4,  4, 10,  0,  3, &montserrat_12_bitmaps[404]}, // '\\' (advance: 4)
+    {93u,  4,  3, 13,  0,  2, &montserrat_12_bitmaps[409]}, // ']' (advance: 4)
+    {94u,  7,  5,  6,  1,  4, &montserrat_12_bitmaps[414]}, // '^' (advance: 7)
+    {95u,  6,  6,  1,  0, 12, &montserrat_12_bitmaps[418]}, // '_' (advance: 6)
+    {96u,  7,  4,  2,  1,  2, &montserrat_12_bitmaps[419]}, // '`' (advance: 7)
+    {97u,  7,  5,  7,  1,  5, &montserrat_12_bitmaps[420]}, // 'a' (advance: 7)
+    {98u,  8,  7, 10,  1,  2, &montserrat_12_bitmaps[425]}, // 'b' (advance: 8)
+    {99u,  7,  6,  7,  0,  5, &montserrat_12_bitmaps[434]}, // 'c' (advance: 7)
+    {100u,  8,  7, 10,  0,  2, &montserrat_12_bitmaps[440]}, // 'd' (advance: 8)
+    {101u,  7,  7,  7,  0,  5, &montserrat_12_bitmaps[449]}, // 'e' (advance: 7)
+    {102u,  4,  4, 10,  0,  2, &montserrat_12_bitmaps[456]}, // 'f' (advance: 4)
+    {103u,  8,  7, 10,  0,  5, &montserrat_12_bitmaps[461]}, // 'g' (advance: 8)
+    {104u,  8,  6, 10,  1,  2, &montserrat_12_bitmaps[470]}, // 'h' (advance: 8)
+    {105u,  3,  1, 10,  1,  2, &montserrat_12_bitmaps[478]}, // 'i' (advance: 3)
+    {106u,  3,  2, 13,  0,  2, &montserrat_12_bitmaps[480]}, // 'j' (advance: 3)
+    {107u,  7,  6, 10,  1,  2, &montserrat_12_bitmaps[484]}, // 'k' (advance: 7)
+    {108u,  3,  1, 10,  1,  2, &montserrat_12_bitmaps[492]}, // 'l' (advance: 3)
+    {109u, 13, 11,  7,  1,  5, &montserrat_12_bitmaps[494]}, // 'm' (advance: 13)
+    {110u,  8,  6,  7,  1,  5, &montserrat_12_bitmaps[504]}, // 'n' (advance: 8)
+    {111u,  8,  7,  7,  0,  5, &montserrat_12_bitmaps[510]}, // 'o' (advance: 8)
+    {112u,  8,  7, 10,  1,  5, &montserrat_12_bitmaps[517]}, // 'p' (advance: 8)
+    {113u,  8,  7, 10,  0,  5, &montserrat_12_bitmaps[526]}, // 'q' (advance: 8)
+    {114u,  5,  4,  7,  1,  5, &montserrat_12_bitmaps[535]}, // 'r' (advance: 5)
+    {115u,  6,  6,  7,  0,  5, &montserrat_12_bitmaps[539]}, // 's' (advance: 6)
+    {116u,  5,  5,  9,  0,  3, &montserrat_12_bitmaps[545]}, // 't' (advance: 5)
+    {117u,  8,  6,  7,  1,  5, &montserrat_12_bitmaps[551]}, // 'u' (advance: 8)
+    {118u,  7,  6,  7,  0,  5, &montserrat_12_bitmaps[557]}, // 'v' (advance: 7)
+    {119u, 11, 11,  7,  0,  5, &montserrat_12_bitmaps[563]}, // 'w' (advance: 11)
+    {120u,  7,  6,  7,  0,  5, &montserrat_12_bitmaps[573]}, // 'x' (advance: 7)
+    {121u,  7,  6, 10,  0,  5, &montserrat_12_bitmaps[579]}, // 'y' (advance: 7)
+    {122u,  6,  6,  7,  0,  5, &montserrat_12_bitmaps[587]}, // 'z' (advance: 6)
+    {123u,  4,  3, 13,  1,  2, &montserrat_12_bitmaps[593]}, // '{' (advance: 4)
+    {124u,  4,  1, 13,  1,  2, &montserrat_12_bitmaps[598]}, // '|' (advance: 4)
+    {125u,  4,  4, 13,  0,  2, &montserrat_12_bitmaps[600]}, // '}' (advance: 4)
+    {126u,  7,  5,  2,  1,  6, &montserrat_12_bitmaps[607]}, // '~' (advance: 7)
+    {127u,  7,  7,  9,  0,  3, &montserrat_12_bitmaps[609]} // \x7F (advance: 7)
 };
 
 #ifdef CONFIG_MICROUI_FONT_KERNING
@@ -479,8 +478,6 @@ const struct mu_FontKerningPair montserrat_12_kerning_pairs[] = {
 
 const struct mu_FontDescriptor montserrat_12 = {
     .height = 16,
-    .bitmap_width = 16,
-    .bytes_per_row = 2,
     .default_width = 7,
     .char_spacing = 1,
     .glyph_count = 96,
@@ -2,219 +2,226 @@
  * Variable Width Bitmap Font Data
  * Generated from: Montserrat-Medium.ttf
  * Font size: 14 pixels
- * Bitmap size: 16x18 pixels
+ * Line height: 18 pixels
  * Average character width: 8.3 pixels
  * Character range: 32-127 (96 requested, 96 total)
- * Format: Variable width, 1 bit per pixel
+ * Format: Variable width, 1 bit per pixel, cropped to the inked pixels
  */
 
 #include <stdint.h>
 #include <microui/font.h>
 
 const uint8_t montserrat_14_bitmaps[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x00, 0x7F, 0x80, 0x12, 0x00, 0x12, 0x00, 0x22, 0x00, 0xFF, 0x80, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x6B, 0x00, 0x48, 0x00, 0x48, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x6B, 0x00, 0x3E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC0, 0x48, 0x80, 0x49, 0x00, 0x4A, 0x00, 0x72, 0xC0, 0x05, 0x20, 0x09, 0x20, 0x09, 0x20, 0x11, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x36, 0x00, 0x22, 0x00, 0x34, 0x00, 0x18, 0x00, 0x2C, 0x80, 0x46, 0x80, 0x43, 0x00, 0x63, 0x80, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA8, 0x00, 0x78, 0x00, 0x70, 0x00, 0xA8, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7E, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x33, 0x00, 0x61, 0x00, 0x41, 0x80, 0x41, 0x80, 0x41, 0x80, 0x41, 0x80, 0x61, 0x00, 0x33, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xC6, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0xC6, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x10, 0x00, 0x22, 0x00, 0x62, 0x00, 0x7F, 0x80, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x7C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0xC6, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0x00, 0x60, 0x00, 0x40, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x23, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC2, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x63, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3E, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x66, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x43, 0x00, 0x7D, 0x00, 0x03, 0x00, 0x02, 0x00, 0x46, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x60, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x38, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xC6, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x18, 0x70, 0x27, 0xB8, 0x6C, 0xE8, 0x48, 0x64, 0x48, 0x24, 0x48, 0x24, 0x48, 0x64, 0x4C, 0xE8, 0x67, 0xB8, 0x20, 0x00, 0x18, 0x40, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x34, 0x00, 0x24, 0x00, 0x62, 0x00, 0x42, 0x00, 0x7F, 0x00, 0x81, 0x00, 0x81, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0x80, 0x7F, 0x00, 0x60, 0x80, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x31, 0xC0, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x31, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x61, 0xC0, 0x60, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x61, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x31, 0xC0, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xC0, 0x40, 0xC0, 0x60, 0xC0, 0x30, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x7F, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x90, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6C, 0x00, 0x7C, 0x00, 0x76, 0x00, 0x63, 0x00, 0x61, 0x80, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x60, 0x30, 0x70, 0x70, 0x78, 0x50, 0x68, 0xD0, 0x6C, 0x90, 0x65, 0x10, 0x63, 0x10, 0x62, 0x10, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x70, 0xC0, 0x78, 0xC0, 0x68, 0xC0, 0x6C, 0xC0, 0x66, 0xC0, 0x63, 0xC0, 0x61, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x31, 0xC0, 0x60, 0x40, 0x40, 0x60, 0x40, 0x20, 0x40, 0x20, 0x40, 0x60, 0x60, 0x40, 0x31, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0x80, 0x60, 0x80, 0x61, 0x80, 0x7F, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x31, 0xC0, 0x60, 0x40, 0x40, 0x60, 0x40, 0x20, 0x40, 0x20, 0x40, 0x60, 0x60, 0x40, 0x31, 0xC0, 0x1F, 0x00, 0x03, 0x30, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0x80, 0x60, 0x80, 0x61, 0x80, 0x7F, 0x00, 0x63, 0x00, 0x61, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x63, 0x00, 0x40, 0x00, 0x40, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x00, 0x63, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x20, 0x80, 0x31, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x81, 0x00, 0xC1, 0x00, 0xC2, 0x00, 0x42, 0x00, 0x66, 0x00, 0x24, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x82, 0x41, 0x86, 0x63, 0x84, 0x22, 0xC4, 0x22, 0x4C, 0x36, 0x4C, 0x14, 0x68, 0x14, 0x28, 0x1C, 0x38, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x80, 0x63, 0x00, 0x32, 0x00, 0x14, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x16, 0x00, 0x32, 0x00, 0x61, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x82, 0x00, 0xC6, 0x00, 0x64, 0x00, 0x28, 0x00, 0x38, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x01, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x20, 0x00, 0x60, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x34, 0x00, 0x24, 0x00, 0x24, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x46, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x42, 0x00, 0x66, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7E, 0x00, 0x73, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0x80, 0x61, 0x80, 0x73, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x63, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x63, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3D, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x62, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x40, 0x00, 0x63, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x28, 0x00, 0x60, 0x00, 0xF8, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x63, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7E, 0x00, 0x73, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x6C, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x66, 0x00, 0x62, 0x00, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x70, 0x73, 0x98, 0x61, 0x0C, 0x61, 0x0C, 0x61, 0x0C, 0x61, 0x0C, 0x61, 0x0C, 0x61, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x73, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x73, 0x00, 0x61, 0x80, 0x60, 0x80, 0x60, 0x80, 0x61, 0x80, 0x73, 0x00, 0x7E, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x63, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x63, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x44, 0x00, 0x40, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x06, 0x00, 0xC4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0xF8, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x61, 0x00, 0x23, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x84, 0x00, 0x84, 0x00, 0xC8, 0x00, 0x48, 0x00, 0x78, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x18, 0x46, 0x10, 0x47, 0x30, 0x65, 0x20, 0x29, 0x20, 0x28, 0xE0, 0x38, 0xC0, 0x10, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x64, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x2C, 0x00, 0x64, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x84, 0x00, 0x84, 0x00, 0xC8, 0x00, 0x48, 0x00, 0x78, 0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE8, 0xF0,
+    0xBB, 0xBA,
+    0x11, 0x08, 0x9F, 0xE2, 0x41, 0x21, 0x13, 0xFE, 0x44, 0x22, 0x11, 0x00,
+    0x10, 0x20, 0x43, 0xED, 0x72, 0x24, 0x38, 0x1C, 0x2C, 0x4E, 0xB7, 0xC2, 0x00,
+    0xE1, 0xA4, 0x49, 0x22, 0x50, 0xE5, 0x82, 0x91, 0x24, 0x49, 0x22, 0x50, 0x60,
+    0x38, 0x6C, 0x44, 0x68, 0x30, 0x59, 0x8D, 0x86, 0xC7, 0x79,
+    0xF0,
+    0x2D, 0x25, 0xB6, 0xC9, 0x26, 0x40,
+    0xC9, 0x92, 0x49, 0x24, 0xB5, 0x80,
+    0x25, 0x5E, 0xEA, 0x90,
+    0x30, 0xC3, 0x3F, 0x30, 0xC3, 0x00,
+    0xBA,
+    0xF0,
+    0xE0,
+    0x11, 0x32, 0x26, 0x44, 0xC8, 0x88,
+    0x3C, 0x66, 0xC2, 0x83, 0x83, 0x83, 0x83, 0xC2, 0x66, 0x3C,
+    0xF3, 0x33, 0x33, 0x33, 0x33,
+    0x7C, 0xC6, 0x02, 0x02, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x7F,
+    0x7E, 0x0C, 0x30, 0xC1, 0xC0, 0xC0, 0x81, 0xC6, 0xF8,
+    0x0C, 0x18, 0x10, 0x20, 0x44, 0xC4, 0xFF, 0x04, 0x04, 0x04,
+    0x7E, 0x60, 0x60, 0x40, 0x7C, 0x06, 0x03, 0x03, 0xC6, 0x7C,
+    0x3E, 0xC7, 0x04, 0x0B, 0xD8, 0xE0, 0xC1, 0x46, 0x78,
+    0xFF, 0xC3, 0xC2, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x18, 0x30,
+    0x7D, 0x8E, 0x0E, 0x37, 0xD8, 0xE0, 0xC1, 0xC6, 0xF8,
+    0x3C, 0x66, 0xC3, 0xC3, 0x43, 0x7D, 0x03, 0x02, 0x46, 0x7C,
+    0xE0, 0x0E,
+    0xE0, 0x0B, 0xA0,
+    0x04, 0xEE, 0x30, 0x38, 0x30,
+    0xFC, 0x00, 0x00, 0xFC,
+    0x81, 0xC1, 0xC3, 0x73, 0x00,
+    0x7D, 0x8C, 0x08, 0x30, 0xC1, 0x06, 0x00, 0x18, 0x30,
+    0x0F, 0x81, 0x87, 0x13, 0xDD, 0xB3, 0xA9, 0x0C, 0xC8, 0x26, 0x41, 0x32, 0x19, 0x99, 0xD6, 0x7B, 0x90, 0x00, 0x61, 0x00, 0xF8, 0x00,
+    0x18, 0x0C, 0x0D, 0x04, 0x86, 0x22, 0x11, 0xFD, 0x02, 0x81, 0xC0, 0x40,
+    0xFE, 0x61, 0xB0, 0x58, 0x2F, 0xE6, 0x0B, 0x07, 0x83, 0xC1, 0xFF, 0x80,
+    0x3E, 0x31, 0xF0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x63, 0x9F, 0x00,
+    0xFE, 0x30, 0xEC, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x02, 0xC3, 0xBF, 0x80,
+    0xFE, 0xC0, 0xC0, 0xC0, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+    0xFF, 0x83, 0x06, 0x0C, 0x1F, 0xF0, 0x60, 0xC1, 0x80,
+    0x1E, 0x31, 0xF0, 0x10, 0x08, 0x04, 0x0E, 0x07, 0x83, 0x61, 0x8F, 0x00,
+    0xC1, 0xE0, 0xF0, 0x78, 0x3F, 0xFE, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xC0,
+    0xFF, 0xFF, 0xF0,
+    0xF8, 0xC6, 0x31, 0x8C, 0x63, 0x97, 0x80,
+    0xC1, 0xE1, 0x31, 0x19, 0x8D, 0x87, 0xC3, 0xB1, 0x8C, 0xC3, 0x60, 0xC0,
+    0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xFC,
+    0xC0, 0x78, 0x0F, 0x83, 0xF8, 0x5D, 0x1B, 0xB2, 0x72, 0x8E, 0x31, 0xC4, 0x38, 0x04,
+    0xC1, 0xF0, 0xFC, 0x7A, 0x3D, 0x9E, 0x6F, 0x1F, 0x87, 0xC1, 0xE0, 0xC0,
+    0x1E, 0x18, 0xEC, 0x0A, 0x03, 0x80, 0x60, 0x18, 0x0F, 0x02, 0x63, 0x87, 0x80,
+    0xFE, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0,
+    0x1E, 0x0C, 0x73, 0x02, 0x40, 0x68, 0x05, 0x00, 0xA0, 0x36, 0x04, 0x63, 0x87, 0xC0, 0x19, 0x81, 0xE0,
+    0xFE, 0x61, 0xB0, 0x58, 0x2C, 0x16, 0x1B, 0xF9, 0x8C, 0xC2, 0x60, 0xC0,
+    0x7D, 0x8E, 0x04, 0x07, 0x03, 0x81, 0x81, 0xC6, 0xF8,
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0x82, 0x63, 0x1F, 0x00,
+    0x81, 0xC0, 0xB0, 0x58, 0x44, 0x23, 0x30, 0x90, 0x78, 0x18, 0x0C, 0x00,
+    0xC1, 0x82, 0x83, 0x0D, 0x8E, 0x11, 0x16, 0x22, 0x24, 0xC6, 0xC9, 0x85, 0x1A, 0x0A, 0x14, 0x1C, 0x38, 0x10, 0x60,
+    0xC1, 0xB1, 0x8C, 0x82, 0x80, 0xC0, 0xE0, 0x58, 0x64, 0x61, 0x60, 0xC0,
+    0x83, 0x82, 0xC6, 0x64, 0x28, 0x38, 0x10, 0x10, 0x10, 0x10,
+    0xFF, 0x02, 0x04, 0x0C, 0x18, 0x30, 0x20, 0x40, 0xC0, 0xFF,
+    0xFB, 0x6D, 0xB6, 0xDB, 0x6D, 0xC0,
+    0x84, 0x30, 0x84, 0x30, 0x84, 0x20, 0x84, 0x20, 0x84,
+    0xE4, 0x92, 0x49, 0x24, 0x93, 0xC0,
+    0x30, 0xC6, 0x92, 0x4A, 0x10,
+    0xFE,
+    0xCC,
+    0x7A, 0x30, 0x5F, 0x86, 0x1C, 0xDD,
+    0xC0, 0xC0, 0xC0, 0xFC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC3, 0xE6, 0xFC,
+    0x79, 0x8E, 0x04, 0x08, 0x10, 0x31, 0x9C,
+    0x02, 0x04, 0x0B, 0xDC, 0x70, 0x60, 0xC1, 0x83, 0x8D, 0xE8,
+    0x79, 0x8A, 0x0F, 0xF8, 0x10, 0x31, 0x9E,
+    0x39, 0x59, 0xF6, 0x31, 0x8C, 0x63, 0x18,
+    0x7B, 0x8E, 0x0C, 0x18, 0x30, 0x71, 0xBD, 0x03, 0x8D, 0xF0,
+    0xC1, 0x83, 0x07, 0xEE, 0x78, 0x70, 0xE1, 0xC3, 0x87, 0x08,
+    0xF3, 0xFF, 0xFC,
+    0xF3, 0xFF, 0xFF, 0xE0,
+    0xC0, 0xC0, 0xC0, 0xC6, 0xCC, 0xD8, 0xF0, 0xF8, 0xCC, 0xC4, 0xC3,
+    0xFF, 0xFF, 0xFC,
+    0xFC, 0xE7, 0x39, 0xB0, 0x87, 0x84, 0x3C, 0x21, 0xE1, 0x0F, 0x08, 0x78, 0x43,
+    0xFD, 0xCF, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+    0x79, 0x8E, 0x0C, 0x18, 0x30, 0x71, 0xBC,
+    0xFC, 0xE6, 0xC3, 0xC1, 0xC1, 0xC3, 0xE6, 0xFC, 0xC0, 0xC0, 0xC0,
+    0x7B, 0x8E, 0x0C, 0x18, 0x30, 0x71, 0xBD, 0x02, 0x04, 0x08,
+    0xFE, 0xCC, 0xCC, 0xCC,
+    0x3C, 0x89, 0x03, 0x81, 0xC0, 0xF1, 0x3E,
+    0x63, 0x3E, 0xC6, 0x31, 0x8C, 0x29, 0xC0,
+    0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x51, 0x9D,
+    0x87, 0x0A, 0x16, 0x44, 0x8F, 0x0C, 0x18,
+    0xC2, 0x1A, 0x30, 0x91, 0xCC, 0xCA, 0x42, 0x92, 0x14, 0x70, 0xE3, 0x02, 0x18,
+    0xC2, 0x64, 0x3C, 0x18, 0x18, 0x2C, 0x64, 0xC3,
+    0x87, 0x0A, 0x16, 0x44, 0x8F, 0x0C, 0x18, 0x20, 0xC3, 0x00,
+    0xFC, 0x21, 0x8C, 0x61, 0x08, 0x3F,
+    0x76, 0x44, 0x44, 0xC4, 0x44, 0x44, 0x63,
+    0xFF, 0xFF, 0xFF, 0xF0,
+    0xC6, 0x22, 0x22, 0x32, 0x22, 0x22, 0x6C,
+    0xE6, 0x70,
+    0xFF, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0xFC,
 };
 
 const struct mu_FontGlyph montserrat_14_glyphs[] = {
-    {32u,  4, 18, &montserrat_14_bitmaps[0]}, // Space (width: 4)
-    {33u,  4, 18, &montserrat_14_bitmaps[36]}, // '!' (width: 4)
-    {34u,  5, 18, &montserrat_14_bitmaps[72]}, // '"' (width: 5)
-    {35u, 10, 18, &montserrat_14_bitmaps[108]}, // '#' (width: 10)
-    {36u,  9, 18, &montserrat_14_bitmaps[144]}, // '$' (width: 9)
-    {37u, 12, 18, &montserrat_14_bitmaps[180]}, // '%' (width: 12)
-    {38u, 10, 18, &montserrat_14_bitmaps[216]}, // '&' (width: 10)
-    {39u,  3, 18, &montserrat_14_bitmaps[252]}, // "'" (width: 3)
-    {40u,  5, 18, &montserrat_14_bitmaps[288]}, // '(' (width: 5)
-    {41u,  5, 18, &montserrat_14_bitmaps[324]}, // ')' (width: 5)
-    {42u,  6, 18, &montserrat_14_bitmaps[360]}, // '*' (width: 6)
-    {43u,  8, 18, &montserrat_14_bitmaps[396]}, // '+' (width: 8)
-    {44u,  3, 18, &montserrat_14_bitmaps[432]}, // ',' (width: 3)
-    {45u,  5, 18, &montserrat_14_bitmaps[468]}, // '-' (width: 5)
-    {46u,  3, 18, &montserrat_14_bitmaps[504]}, // '.' (width: 3)
-    {47u,  7, 18, &montserrat_14_bitmaps[540]}, // '/' (width: 7)
-    {48u,  9, 18, &montserrat_14_bitmaps[576]}, // '0' (width: 9)
-    {49u,  5, 18, &montserrat_14_bitmaps[612]}, // '1' (width: 5)
-    {50u,  8, 18, &montserrat_14_bitmaps[648]}, // '2' (width: 8)
-    {51u,  8, 18, &montserrat_14_bitmaps[684]}, // '3' (width: 8)
-    {52u, 10, 18, &montserrat_14_bitmaps[720]}, // '4' (width: 10)
-    {53u,  8, 18, &montserrat_14_bitmaps[756]}, // '5' (width: 8)
-    {54u,  9, 18, &montserrat_14_bitmaps[792]}, // '6' (width: 9)
-    {55u,  8, 18, &montserrat_14_bitmaps[828]}, // '7' (width: 8)
-    {56u,  9, 18, &montserrat_14_bitmaps[864]}, // '8' (width: 9)
-    {57u,  9, 18, &montserrat_14_bitmaps[900]}, // '9' (width: 9)
-    {58u,  3, 18, &montserrat_14_bitmaps[936]}, // ':' (width: 3)
-    {59u,  3, 18, &montserrat_14_bitmaps[972]}, // ';' (width: 3)
-    {60u,  8, 18, &montserrat_14_bitmaps[1008]}, // '<' (width: 8)
-    {61u,  8, 18, &montserrat_14_bitmaps[1044]}, // '=' (width: 8)
-    {62u,  8, 18, &montserrat_14_bitmaps[1080]}, // '>' (width: 8)
-    {63u,  8, 18, &montserrat_14_bitmaps[1116]}, // '?' (width: 8)
-    {64u, 14, 18, &montserrat_14_bitmaps[1152]}, // '@' (width: 14)
-    {65u, 12, 18, &montserrat_14_bitmaps[1188]}, // 'A' (width: 12)
-    {66u, 11, 18, &montserrat_14_bitmaps[1224]}, // 'B' (width: 11)
-    {67u, 10, 18, &montserrat_14_bitmaps[1260]}, // 'C' (width: 10)
-    {68u, 12, 18, &montserrat_14_bitmaps[1296]}, // 'D' (width: 12)
-    {69u,  9, 18, &montserrat_14_bitmaps[1332]}, // 'E' (width: 9)
-    {70u,  9, 18, &montserrat_14_bitmaps[1368]}, // 'F' (width: 9)
-    {71u, 11, 18, &montserrat_14_bitmaps[1404]}, // 'G' (width: 11)
-    {72u, 11, 18, &montserrat_14_bitmaps[1440]}, // 'H' (width: 11)
-    {73u,  4, 18, &montserrat_14_bitmaps[1476]}, // 'I' (width: 4)
-    {74u,  8, 18, &montserrat_14_bitmaps[1512]}, // 'J' (width: 8)
-    {75u, 11, 18, &montserrat_14_bitmaps[1548]}, // 'K' (width: 11)
-    {76u,  9, 18, &montserrat_14_bitmaps[1584]}, // 'L' (width: 9)
-    {77u, 13, 18, &montserrat_14_bitmaps[1620]}, // 'M' (width: 13)
-    {78u, 11, 18, &montserrat_14_bitmaps[1656]}, // 'N' (width: 11)
-    {79u, 12, 18, &montserrat_14_bitmaps[1692]}, // 'O' (width: 12)
-    {80u, 10, 18, &montserrat_14_bitmaps[1728]}, // 'P' (width: 10)
-    {81u, 12, 18, &montserrat_14_bitmaps[1764]}, // 'Q' (width: 12)
-    {82u, 10, 18, &montserrat_14_bitmaps[1800]}, // 'R' (width: 10)
-    {83u,  9, 18, &montserrat_14_bitmaps[1836]}, // 'S' (width: 9)
-    {84u,  9, 18, &montserrat_14_bitmaps[1872]}, // 'T' (width: 9)
-    {85u, 11, 18, &montserrat_14_bitmaps[1908]}, // 'U' (width: 11)
-    {86u, 11, 18, &montserrat_14_bitmaps[1944]}, // 'V' (width: 11)
-    {87u, 16, 18, &montserrat_14_bitmaps[1980]}, // 'W' (width: 16)
-    {88u, 10, 18, &montserrat_14_bitmaps[2016]}, // 'X' (width: 10)
-    {89u, 11, 18, &montserrat_14_bitmaps[2052]}, // 'Y' (width: 11)
-    {90u,  9, 18, &montserrat_14_bitmaps[2088]}, // 'Z' (width: 9)
-    {91u,  5, 18, &montserrat_14_bitmaps[2124]}, // '[' (width: 5)
-    {92u,  7, 18, &montserrat_14_bitmaps[2160]}, // '\\' (width: 7)
-    {93u,  5, 18, &montserrat_14_bitmaps[2196]}, // ']' (width: 5)
-    {94u,  8, 18, &montserrat_14_bitmaps[2232]}, // '^' (width: 8)
-    {95u,  7, 18, &montserrat_14_bitmaps[2268]}, // '_' (width: 7)
-    {96u,  8, 18, &montserrat_14_bitmaps[2304]}, // '`' (width: 8)
-    {97u,  8, 18, &montserrat_14_bitmaps[2340]}, // 'a' (width: 8)
-    {98u, 10, 18, &montserrat_14_bitmaps[2376]}, // 'b' (width: 10)
-    {99u,  8, 18, &montserrat_14_bitmaps[2412]}, // 'c' (width: 8)
-    {100u, 10, 18, &montserrat_14_bitmaps[2448]}, // 'd' (width: 10)
-    {101u,  9, 18, &montserrat_14_bitmaps[2484]}, // 'e' (width: 9)
-    {102u,  6, 18, &montserrat_14_bitmaps[2520]}, // 'f' (width: 6)
-    {103u, 10, 18, &montserrat_14_bitmaps[2556]}, // 'g' (width: 10)
-    {104u, 10, 18, &montserrat_14_bitmaps[2592]}, // 'h' (width: 10)
-    {105u,  4, 18, &montserrat_14_bitmaps[2628]}, // 'i' (width: 4)
-    {106u,  6, 18, &montserrat_14_bitmaps[2664]}, // 'j' (width: 6)
-    {107u,  9, 18, &montserrat_14_bitmaps[2700]}, // 'k' (width: 9)
-    {108u,  4, 18, &montserrat_14_bitmaps[2736]}, // 'l' (width: 4)
-    {109u, 15, 18, &montserrat_14_bitmaps[2772]}, // 'm' (width: 15)
-    {110u, 10, 18, &montserrat_14_bitmaps[2808]}, // 'n' (width: 10)
-    {111u,  9, 18, &montserrat_14_bitmaps[2844]}, // 'o' (width: 9)
-    {112u, 10, 18, &montserrat_14_bitmaps[2880]}, // 'p' (width: 10)
-    {113u, 10, 18, &montserrat_14_bitmaps[2916]}, // 'q' (width: 10)
-    {114u,  6, 18, &montserrat_14_bitmaps[2952]}, // 'r' (width: 6)
-    {115u,  7, 18, &montserrat_14_bitmaps[2988]}, // 's' (width: 7)
-    {116u,  6, 18, &montserrat_14_bitmaps[3024]}, // 't' (width: 6)
-    {117u,  9, 18, &montserrat_14_bitmaps[3060]}, // 'u' (width: 9)
-    {118u,  9, 18, &montserrat_14_bitmaps[3096]}, // 'v' (width: 9)
-    {119u, 13, 18, &montserrat_14_bitmaps[3132]}, // 'w' (width: 13)
-    {120u,  8, 18, &montserrat_14_bitmaps[3168]}, // 'x' (width: 8)
-    {121u,  9, 18, &montserrat_14_bitmaps[3204]}, // 'y' (width: 9)
-    {122u,  7, 18, &montserrat_14_bitmaps[3240]}, // 'z' (width: 7)
-    {123u,  5, 18, &montserrat_14_bitmaps[3276]}, // '{' (width: 5)
-    {124u,  4, 18, &montserrat_14_bitmaps[3312]}, // '|' (width: 4)
-    {125u,  5, 18, &montserrat_14_bitmaps[3348]}, // '}' (width: 5)
-    {126u,  8, 18, &montserrat_14_bitmaps[3384]}, // '~' (width: 8)
-    {127u,  8, 18, &montserrat_14_bitmaps[3420]} // \x7F (width: 8)
+    {32u,  4,  0,  0,  0,  0, &montserrat_14_bitmaps[0]}, // Space (advance: 4)
+    {33u,  4,  2, 10,  1,  4, &montserrat_14_bitmaps[0]}, // '!' (advance: 4)
+    {34u,  5,  4,  4,  1,  4, &montserrat_14_bitmaps[3]}, // '"' (advance: 5)
+    {35u, 10,  9, 10,  0,  4, &montserrat_14_bitmaps[5]}, // '#' (advance: 10)
+    {36u,  9,  7, 14,  1,  1, &montserrat_14_bitmaps[17]}, // '$' (advance: 9)
+    {37u, 12, 10, 10,  1,  4, &montserrat_14_bitmaps[30]}, // '%' (advance: 12)
+    {38u, 10,  8, 10,  1,  4, &montserrat_14_bitmaps[43]}, // '&' (advance: 10)
+    {39u,  3,  1,  4,  1,  4, &montserrat_14_bitmaps[53]}, // "'" (advance: 3)
+    {40u,  5,  3, 14,  1,  3, &montserrat_14_bitmaps[54]}, // '(' (advance: 5)
+    {41u,  5,  3, 14,  0,  3, &montserrat_14_bitmaps[60]}, // ')' (advance: 5)
+    {42u,  6,  5,  6,  0,  3, &montserrat_14_bitmaps[66]}, // '*' (advance: 6)
+    {43u,  8,  6,  7,  1,  5, &montserrat_14_bitmaps[70]}, // '+' (advance: 8)
+    {44u,  3,  2,  4,  1, 12, &montserrat_14_bitmaps[76]}, // ',' (advance: 3)
+    {45u,  5,  4,  1,  1,  8, &montserrat_14_bitmaps[77]}, // '-' (advance: 5)
+    {46u,  3,  2,  2,  1, 11, &montserrat_14_bitmaps[78]}, // '.' (advance: 3)
+    {47u,  7,  4, 12,  0,  1, &montserrat_14_bitmaps[79]}, // '/' (advance: 7)
+    {48u,  9,  8, 10,  1,  4, &montserrat_14_bitmaps[85]}, // '0' (advance: 9)
+    {49u,  5,  4, 10,  0,  4, &montserrat_14_bitmaps[95]}, // '1' (advance: 5)
+    {50u,  8,  8, 10,  0,  4, &montserrat_14_bitmaps[100]}, // '2' (advance: 8)
+    {51u,  8,  7, 10,  0,  4, &montserrat_14_bitmaps[110]}, // '3' (advance: 8)
+    {52u, 10,  8, 10,  1,  4, &montserrat_14_bitmaps[119]}, // '4' (advance: 10)
+    {53u,  8,  8, 10,  0,  4, &montserrat_14_bitmaps[129]}, // '5' (advance: 8)
+    {54u,  9,  7, 10,  1,  4, &montserrat_14_bitmaps[139]}, // '6' (advance: 9)
+    {55u,  8,  8, 10,  0,  4, &montserrat_14_bitmaps[148]}, // '7' (advance: 8)
+    {56u,  9,  7, 10,  1,  4, &montserrat_14_bitmaps[158]}, // '8' (advance: 9)
+    {57u,  9,  8, 10,  0,  4, &montserrat_14_bitmaps[167]}, // '9' (advance: 9)
+    {58u,  3,  2,  8,  1,  5, &montserrat_14_bitmaps[177]}, // ':' (advance: 3)
+    {59u,  3,  2, 10,  1,  5, &montserrat_14_bitmaps[179]}, // ';' (advance: 3)
+    {60u,  8,  6,  6,  1,  6, &montserrat_14_bitmaps[182]}, // '<' (advance: 8)
+    {61u,  8,  6,  5,  1,  6, &montserrat_14_bitmaps[187]}, // '=' (advance: 8)
+    {62u,  8,  6,  6,  1,  6, &montserrat_14_bitmaps[191]}, // '>' (advance: 8)
+    {63u,  8,  7, 10,  0,  4, &montserrat_14_bitmaps[196]}, // '?' (advance: 8)
+    {64u, 14, 13, 13,  1,  4, &montserrat_14_bitmaps[205]}, // '@' (advance: 14)
+    {65u, 12,  9, 10,  0,  4, &montserrat_14_bitmaps[227]}, // 'A' (advance: 12)
+    {66u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[239]}, // 'B' (advance: 11)
+    {67u, 10,  9, 10,  1,  4, &montserrat_14_bitmaps[251]}, // 'C' (advance: 10)
+    {68u, 12, 10, 10,  1,  4, &montserrat_14_bitmaps[263]}, // 'D' (advance: 12)
+    {69u,  9,  8, 10,  1,  4, &montserrat_14_bitmaps[276]}, // 'E' (advance: 9)
+    {70u,  9,  7, 10,  1,  4, &montserrat_14_bitmaps[286]}, // 'F' (advance: 9)
+    {71u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[295]}, // 'G' (advance: 11)
+    {72u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[307]}, // 'H' (advance: 11)
+    {73u,  4,  2, 10,  1,  4, &montserrat_14_bitmaps[319]}, // 'I' (advance: 4)
+    {74u,  8,  5, 10,  0,  4, &montserrat_14_bitmaps[322]}, // 'J' (advance: 8)
+    {75u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[329]}, // 'K' (advance: 11)
+    {76u,  9,  7, 10,  1,  4, &montserrat_14_bitmaps[341]}, // 'L' (advance: 9)
+    {77u, 13, 11, 10,  1,  4, &montserrat_14_bitmaps[350]}, // 'M' (advance: 13)
+    {78u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[364]}, // 'N' (advance: 11)
+    {79u, 12, 10, 10,  1,  4, &montserrat_14_bitmaps[376]}, // 'O' (advance: 12)
+    {80u, 10,  8, 10,  1,  4, &montserrat_14_bitmaps[389]}, // 'P' (advance: 10)
+    {81u, 12, 11, 12,  1,  4, &montserrat_14_bitmaps[399]}, // 'Q' (advance: 12)
+    {82u, 10,  9, 10,  1,  4, &montserrat_14_bitmaps[416]}, // 'R' (advance: 10)
+    {83u,  9,  7, 10,  1,  4, &montserrat_14_bitmaps[428]}, // 'S' (advance: 9)
+    {84u,  9,  8, 10,  0,  4, &montserrat_14_bitmaps[437]}, // 'T' (advance: 9)
+    {85u, 11,  9, 10,  1,  4, &montserrat_14_bitmaps[447]}, // 'U' (advance: 11)
+    {86u, 11,  9, 10,  0,  4, &montserrat_14_bitmaps[459]}, // 'V' (advance: 11)
+    {87u, 16, 15, 10,  0,  4, &montserrat_14_bitmaps[471]}, // 'W' (advance: 16)
+    {88u, 10,  9, 10,  0,  4, &montserrat_14_bitmaps[490]}, // 'X' (advance: 10)
+    {89u, 11,  8, 10,  0,  4, &montserrat_14_bitmaps[502]}, // 'Y' (advance: 11)
+    {90u,  9,  8, 10,  1,  4, &montserrat_14_bitmaps[512]}, // 'Z' (advance: 9)
+    {91u,  5,  3, 14,  1,  3, &montserrat_14_bitmaps[522]}, // '[' (advance: 5)
+    {92u,  7,  5, 14,  0,  1, &montserrat_14_bitmaps[528]}, // '\\' (advance: 7)
+    {93u,  5,  3, 14,  0,  3, &montserrat_14_bitmaps[537]}, // ']' (advance: 5)
+    {94u,  8,  6,  6,  1,  6, &montserrat_14_bitmaps[543]}, // '^' (advance: 8)
+    {95u,  7,  7,  1,  0, 13, &montserrat_14_bitmaps[548]}, // '_' (advance: 7)
+    {96u,  8,  3,  2,  2,  3, &montserrat_14_bitmaps[549]}, // '`' (advance: 8)
+    {97u,  8,  6,  8,  1,  6, &montserrat_14_bitmaps[550]}, // 'a' (advance: 8)
+    {98u, 10,  8, 11,  1,  3, &montserrat_14_bitmaps[556]}, // 'b' (advance: 10)
+    {99u,  8,  7,  8,  1,  6, &montserrat_14_bitmaps[567]}, // 'c' (advance: 8)
+    {100u, 10,  7, 11,  1,  3, &montserrat_14_bitmaps[574]}, // 'd' (advance: 10)
+    {101u,  9,  7,  8,  1,  6, &montserrat_14_bitmaps[584]}, // 'e' (advance: 9)
+    {102u,  6,  5, 11,  0,  3, &montserrat_14_bitmaps[591]}, // 'f' (advance: 6)
+    {103u, 10,  7, 11,  1,  6, &montserrat_14_bitmaps[598]}, // 'g' (advance: 10)
+    {104u, 10,  7, 11,  1,  3, &montserrat_14_bitmaps[608]}, // 'h' (advance: 10)
+    {105u,  4,  2, 11,  1,  3, &montserrat_14_bitmaps[618]}, // 'i' (advance: 4)
+    {106u,  6,  2, 14,  0,  3, &montserrat_14_bitmaps[621]}, // 'j' (advance: 6)
+    {107u,  9,  8, 11,  1,  3, &montserrat_14_bitmaps[625]}, // 'k' (advance: 9)
+    {108u,  4,  2, 11,  1,  3, &montserrat_14_bitmaps[636]}, // 'l' (advance: 4)
+    {109u, 15, 13,  8,  1,  6, &montserrat_14_bitmaps[639]}, // 'm' (advance: 15)
+    {110u, 10,  7,  8,  1,  6, &montserrat_14_bitmaps[652]}, // 'n' (advance: 10)
+    {111u,  9,  7,  8,  1,  6, &montserrat_14_bitmaps[659]}, // 'o' (advance: 9)
+    {112u, 10,  8, 11,  1,  6, &montserrat_14_bitmaps[666]}, // 'p' (advance: 10)
+    {113u, 10,  7, 11,  1,  6, &montserrat_14_bitmaps[677]}, // 'q' (advance: 10)
+    {114u,  6,  4,  8,  1,  6, &montserrat_14_bitmaps[687]}, // 'r' (advance: 6)
+    {115u,  7,  7,  8,  0,  6, &montserrat_14_bitmaps[691]}, // 's' (advance: 7)
+    {116u,  6,  5, 10,  0,  4, &montserrat_14_bitmaps[698]}, // 't' (advance: 6)
+    {117u,  9,  7,  8,  1,  6, &montserrat_14_bitmaps[705]}, // 'u' (advance: 9)
+    {118u,  9,  7,  8,  0,  6, &montserrat_14_bitmaps[712]}, // 'v' (advance: 9)
+    {119u, 13, 13,  8,  0,  6, &montserrat_14_bitmaps[719]}, // 'w' (advance: 13)
+    {120u,  8,  8,  8,  0,  6, &montserrat_14_bitmaps[732]}, // 'x' (advance: 8)
+    {121u,  9,  7, 11,  0,  6, &montserrat_14_bitmaps[740]}, // 'y' (advance: 9)
+    {122u,  7,  6,  8,  1,  6, &montserrat_14_bitmaps[750]}, // 'z' (advance: 7)
+    {123u,  5,  4, 14,  1,  3, &montserrat_14_bitmaps[756]}, // '{' (advance: 5)
+    {124u,  4,  2, 14,  1,  3, &montserrat_14_bitmaps[763]}, // '|' (advance: 4)
+    {125u,  5,  4, 14,  0,  3, &montserrat_14_bitmaps[767]}, // '}' (advance: 5)
+    {126u,  8,  6,  2,  1,  7, &montserrat_14_bitmaps[774]}, // '~' (advance: 8)
+    {127u,  8,  7, 10,  1,  4, &montserrat_14_bitmaps[776]} // \x7F (advance: 8)
 };
 
+#ifdef CONFIG_MICROUI_FONT_KERNING
+const struct mu_FontKerningPair montserrat_14_kerning_pairs[] = {
+    {0u, 0u, 0}
+};
+#endif
+
 const struct mu_FontDescriptor montserrat_14 = {
     .height = 18,
-    .bitmap_width = 16,
-    .bytes_per_row = 2,
     .default_width = 8,
     .char_spacing = 1,
     .glyph_count = 96,
-    .glyphs = montserrat_14_glyphs
+    .glyphs = montserrat_14_glyphs,
+#ifdef CONFIG_MICROUI_FONT_KERNING
+    .kerning_count = 0,
+    .kerning_pairs = montserrat_14_kerning_pairs
+#endif
 };
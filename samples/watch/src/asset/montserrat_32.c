@@ -2,55 +2,63 @@
  * Variable Width Bitmap Font Data
  * Generated from: Montserrat-Medium.ttf
  * Font size: 32 pixels
- * Bitmap size: 32x32 pixels
+ * Line height: 32 pixels
  * Average character width: 19.6 pixels
  * Character range: 48-80 (14 requested, 14 total)
- * Format: Variable width, 1 bit per pixel
+ * Format: Variable width, 1 bit per pixel, cropped to the inked pixels
  */
 
 #include <stdint.h>
 #include <microui/font.h>
 
 const uint8_t montserrat_32_bitmaps[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x1E, 0x01, 0xC0, 0x00, 0x1C, 0x01, 0xE0, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x70, 0x00, 0x38, 0x00, 0x70, 0x00, 0x38, 0x00, 0x70, 0x00, 0x38, 0x00, 0x70, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x1C, 0x01, 0xE0, 0x00, 0x1E, 0x01, 0xC0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x40, 0x07, 0x00, 0x00, 0x70, 0x0F, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x83, 0x80, 0x00, 0x0F, 0x03, 0x80, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x1C, 0x03, 0x80, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x20, 0x07, 0x80, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x78, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x3E, 0x01, 0xC0, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x1C, 0x01, 0xC0, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x70, 0x03, 0x80, 0x00, 0x70, 0x07, 0x80, 0x00, 0x70, 0x07, 0x00, 0x00, 0x70, 0x0F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x38, 0x01, 0xC0, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x38, 0x01, 0xE0, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x38, 0x01, 0xE0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x78, 0x03, 0x80, 0x00, 0x70, 0x03, 0x80, 0x00, 0x70, 0x03, 0xC0, 0x00, 0x70, 0x03, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0xC0, 0x00, 0x07, 0xF1, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x80, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x1E, 0x01, 0xC0, 0x00, 0x1C, 0x01, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x1E, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x01, 0xE0, 0x1F, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x03, 0xE0, 0x1F, 0x80, 0x07, 0xE0, 0x1D, 0xC0, 0x07, 0xE0, 0x1D, 0xE0, 0x0E, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x1C, 0x70, 0x1C, 0xE0, 0x1C, 0x70, 0x38, 0xE0, 0x1C, 0x38, 0x38, 0xE0, 0x1C, 0x3C, 0x70, 0xE0, 0x1C, 0x1C, 0xF0, 0xE0, 0x1C, 0x0E, 0xE0, 0xE0, 0x1C, 0x0F, 0xC0, 0xE0, 0x1C, 0x07, 0xC0, 0xE0, 0x1C, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xE0, 0xF0, 0x3C, 0x78, 0x07, 0x1C, 0x01, 0xEE, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x3B, 0x80, 0x0E, 0x70, 0x07, 0x9E, 0x01, 0xC3, 0xC0, 0xF0, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0xF0, 0x0F, 0xFE, 0x1F, 0xFF, 0x9F, 0x01, 0xE2, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFC,
+    0x7F, 0xFF, 0x3F, 0xFF, 0x9F, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0xA0, 0x03, 0x9C, 0x03, 0xDF, 0xFF, 0xC3, 0xFF, 0xC0, 0x7F, 0x80,
+    0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x70, 0x1E, 0x07, 0x01, 0xC0, 0x70, 0x38, 0x07, 0x07, 0x80, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
+    0x3F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFE, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x7F, 0xC0, 0x7F, 0xF8, 0x7F, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x40, 0x0F, 0xF0, 0x1E, 0xFF, 0xFE, 0x7F, 0xF8, 0x0F, 0xF0,
+    0x01, 0xFC, 0x07, 0xFF, 0x87, 0xFF, 0x87, 0x80, 0x47, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0xE1, 0xE0, 0x73, 0xFE, 0x3F, 0xFF, 0x9F, 0x83, 0xEF, 0x80, 0x77, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xB8, 0x03, 0x9E, 0x03, 0xC7, 0xFF, 0xC1, 0xFF, 0xC0, 0x3F, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xEE, 0x00, 0xF7, 0x00, 0x73, 0x80, 0x78, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00,
+    0x03, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0xF0, 0x1E, 0x78, 0x03, 0x9C, 0x00, 0xE7, 0x00, 0x39, 0xE0, 0x0E, 0x3C, 0x0F, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xFC, 0x78, 0x07, 0x9C, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xDC, 0x00, 0xF7, 0x80, 0x78, 0xFF, 0xFE, 0x1F, 0xFF, 0x01, 0xFE, 0x00,
+    0x07, 0xE0, 0x0F, 0xFC, 0x1F, 0xFF, 0x0F, 0x03, 0xCF, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x1F, 0xC0, 0x0F, 0xF0, 0x07, 0xBC, 0x0F, 0xDF, 0xFF, 0xE7, 0xFF, 0x70, 0xFE, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x08, 0x0F, 0x87, 0xFF, 0x87, 0xFF, 0x00, 0xFE, 0x00,
+    0x77, 0xDE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xEF, 0x70,
+    0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xDC, 0x00, 0x07, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE1, 0xC0, 0x07, 0x07, 0x00, 0x1C, 0x1E, 0x00, 0xE0, 0x38, 0x03, 0x80, 0xF0, 0x1E, 0x01, 0xC0, 0x70, 0x07, 0x83, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xC0, 0x01, 0xC7, 0x00, 0x03, 0xB8, 0x00, 0x0E, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x70,
+    0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xEE, 0x00, 0x3F, 0xEF, 0x00, 0x77, 0xE7, 0x00, 0xF7, 0xE3, 0x80, 0xE7, 0xE3, 0x81, 0xC7, 0xE1, 0xC1, 0xC7, 0xE1, 0xE3, 0x87, 0xE0, 0xE7, 0x87, 0xE0, 0x77, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x3E, 0x07, 0xE0, 0x3C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+    0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xFF, 0xFB, 0xC0, 0x1E, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x1E, 0xFF, 0xFF, 0x3F, 0xFF, 0x8F, 0xFF, 0x83, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00,
 };
 
 const struct mu_FontGlyph montserrat_32_glyphs[] = {
-    {48u, 21, 32, &montserrat_32_bitmaps[0]}, // '0' (width: 21)
-    {49u, 12, 32, &montserrat_32_bitmaps[128]}, // '1' (width: 12)
-    {50u, 18, 32, &montserrat_32_bitmaps[256]}, // '2' (width: 18)
-    {51u, 18, 32, &montserrat_32_bitmaps[384]}, // '3' (width: 18)
-    {52u, 22, 32, &montserrat_32_bitmaps[512]}, // '4' (width: 22)
-    {53u, 18, 32, &montserrat_32_bitmaps[640]}, // '5' (width: 18)
-    {54u, 20, 32, &montserrat_32_bitmaps[768]}, // '6' (width: 20)
-    {55u, 19, 32, &montserrat_32_bitmaps[896]}, // '7' (width: 19)
-    {56u, 21, 32, &montserrat_32_bitmaps[1024]}, // '8' (width: 21)
-    {57u, 20, 32, &montserrat_32_bitmaps[1152]}, // '9' (width: 20)
-    {58u,  7, 32, &montserrat_32_bitmaps[1280]}, // ':' (width: 7)
-    {65u, 25, 32, &montserrat_32_bitmaps[1408]}, // 'A' (width: 25)
-    {77u, 31, 32, &montserrat_32_bitmaps[1536]}, // 'M' (width: 31)
-    {80u, 23, 32, &montserrat_32_bitmaps[1664]} // 'P' (width: 23)
+    {48u, 21, 18, 22,  2,  9, &montserrat_32_bitmaps[0]}, // '0' (advance: 21)
+    {49u, 12,  8, 22,  0,  9, &montserrat_32_bitmaps[50]}, // '1' (advance: 12)
+    {50u, 18, 17, 22,  0,  9, &montserrat_32_bitmaps[72]}, // '2' (advance: 18)
+    {51u, 18, 17, 22,  0,  9, &montserrat_32_bitmaps[119]}, // '3' (advance: 18)
+    {52u, 22, 20, 22,  1,  9, &montserrat_32_bitmaps[166]}, // '4' (advance: 22)
+    {53u, 18, 16, 22,  1,  9, &montserrat_32_bitmaps[221]}, // '5' (advance: 18)
+    {54u, 20, 17, 22,  2,  9, &montserrat_32_bitmaps[265]}, // '6' (advance: 20)
+    {55u, 19, 17, 22,  1,  9, &montserrat_32_bitmaps[312]}, // '7' (advance: 19)
+    {56u, 21, 18, 22,  1,  9, &montserrat_32_bitmaps[359]}, // '8' (advance: 21)
+    {57u, 20, 17, 22,  1,  9, &montserrat_32_bitmaps[409]}, // '9' (advance: 20)
+    {58u,  7,  5, 17,  1, 14, &montserrat_32_bitmaps[456]}, // ':' (advance: 7)
+    {65u, 25, 22, 22,  0,  9, &montserrat_32_bitmaps[467]}, // 'A' (advance: 25)
+    {77u, 31, 24, 22,  3,  9, &montserrat_32_bitmaps[528]}, // 'M' (advance: 31)
+    {80u, 23, 18, 22,  3,  9, &montserrat_32_bitmaps[594]} // 'P' (advance: 23)
 };
 
+#ifdef CONFIG_MICROUI_FONT_KERNING
+const struct mu_FontKerningPair montserrat_32_kerning_pairs[] = {
+    {0u, 0u, 0}
+};
+#endif
+
 const struct mu_FontDescriptor montserrat_32 = {
     .height = 32,
-    .bitmap_width = 32,
-    .bytes_per_row = 4,
     .default_width = 20,
     .char_spacing = 1,
     .glyph_count = 14,
-    .glyphs = montserrat_32_glyphs
+    .glyphs = montserrat_32_glyphs,
+#ifdef CONFIG_MICROUI_FONT_KERNING
+    .kerning_count = 0,
+    .kerning_pairs = montserrat_32_kerning_pairs
+#endif
 };
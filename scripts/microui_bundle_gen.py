@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+MicroUI Asset Bundle Generator
+
+This script packs fonts and images into one binary bundle that is loaded at
+runtime with mu_bundle_open(), see include/microui/bundle.h. The descriptors in
+the bundle have the in-memory layout of struct mu_FontDescriptor and struct
+mu_ImageDescriptor for the target, with pointers resolved for the address the
+bundle is stored at, so it is used in place.
+
+The assets are listed in a JSON manifest, paths are relative to it:
+
+{
+    "fonts": [
+        {"name": "body", "file": "fonts/NotoSans.ttf", "size": 16, "range": "32-127"}
+    ],
+    "images": [
+        {"name": "album", "file": "album.png", "format": "RGB_565", "width": 120}
+    ]
+}
+
+Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+SPDX-License-Identifier: Apache-2.0
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+import zlib
+
+from microui_font_gen import parse_character_ranges, render_font
+from microui_image_gen import (
+    PIXEL_FORMATS,
+    calculate_stride,
+    convert_image_to_format,
+    load_and_resize_image,
+)
+
+# Must match include/microui/bundle.h
+BUNDLE_MAGIC = 0x4241554D
+BUNDLE_VERSION = 1
+BUNDLE_ALIGN = 8
+BUNDLE_NAME_LEN = 24
+ENTRY_FONT = 1
+ENTRY_IMAGE = 2
+
+HEADER = struct.Struct("<IHBBIIQHHHHII")
+ENTRY = struct.Struct(f"<{BUNDLE_NAME_LEN}sII")
+
+
+class Target:
+    """Structure layout of the target, following its C ABI."""
+
+    def __init__(self, pointer_size, kerning, asset_storage):
+        self.pointer_size = pointer_size
+        self.kerning = kerning
+        self.asset_storage = asset_storage
+
+    def pack(self, fields):
+        """Pack (kind, value) fields like a C struct, with natural alignment."""
+        sizes = {"u32": 4, "enum": 4, "u8": 1, "i8": 1, "ptr": self.pointer_size}
+        codes = {"u32": "I", "enum": "I", "u8": "B", "i8": "b"}
+        codes["ptr"] = "I" if self.pointer_size == 4 else "Q"
+
+        data = bytearray()
+        struct_align = 1
+        for kind, value in fields:
+            size = sizes[kind]
+            struct_align = max(struct_align, size)
+            data += bytes(-len(data) % size)
+            data += struct.pack("<" + codes[kind], value)
+        data += bytes(-len(data) % struct_align)
+        return bytes(data)
+
+    def font_descriptor(self, height, default_width, glyph_count, glyphs, kerning_count=0,
+                        kerning_pairs=0):
+        fields = [
+            ("u32", height),
+            ("u32", default_width),
+            ("u32", 1),  # char_spacing
+            ("u32", glyph_count),
+            ("ptr", glyphs),
+        ]
+        if self.kerning:
+            fields += [("u32", kerning_count), ("ptr", kerning_pairs)]
+        if self.asset_storage:
+            fields += [("ptr", 0)]
+        return self.pack(fields)
+
+    def glyph(self, code=0, advance=0, width=0, height=0, x_offset=0, y_offset=0, bitmap=0):
+        return self.pack(
+            [
+                ("u32", code),
+                ("u8", advance),
+                ("u8", width),
+                ("u8", height),
+                ("i8", x_offset),
+                ("i8", y_offset),
+                ("ptr", bitmap),
+            ]
+        )
+
+    def kerning_pair(self, left=0, right=0, adjustment=0):
+        return self.pack([("u32", left), ("u32", right), ("i8", adjustment)])
+
+    def image_descriptor(self, width=0, height=0, stride=0, data_size=0, data=0,
+                         pixel_format=0):
+        fields = [
+            ("u32", width),
+            ("u32", height),
+            ("u32", stride),
+            ("u32", data_size),
+            ("ptr", data),
+            ("enum", pixel_format),
+            ("enum", 0),  # MU_IMAGE_COMPRESSION_NONE
+        ]
+        if self.asset_storage:
+            fields += [("ptr", 0)]
+        return self.pack(fields)
+
+
+class Bundle:
+    def __init__(self, target, base, entry_count):
+        self.target = target
+        self.base = base
+        self.entries = []
+        self.data = bytearray(HEADER.size + entry_count * ENTRY.size)
+
+    def add(self, blob):
+        """Append an aligned blob, return its address."""
+        self.data += bytes(-len(self.data) % BUNDLE_ALIGN)
+        offset = len(self.data)
+        self.data += blob
+        return self.base + offset
+
+    def add_entry(self, name, entry_type, address):
+        encoded = name.encode("utf-8")
+        if len(encoded) >= BUNDLE_NAME_LEN:
+            raise ValueError(f"Asset name too long (max {BUNDLE_NAME_LEN - 1} bytes): {name}")
+        if any(entry[0] == encoded for entry in self.entries):
+            raise ValueError(f"Duplicate asset name: {name}")
+        self.entries.append((encoded, entry_type, address - self.base))
+
+    def add_font(self, name, ttf_path, size, character_codes):
+        target = self.target
+        height, avg_width, glyphs, kerning_pairs = render_font(ttf_path, size, character_codes)
+
+        bitmaps = b"".join(bytes(glyph[6]) for glyph in glyphs)
+        bitmaps_address = self.add(bitmaps)
+
+        glyph_table = bytearray()
+        bitmap_address = bitmaps_address
+        for code, advance, x_offset, y_offset, width, glyph_height, bitmap in glyphs:
+            glyph_table += target.glyph(
+                code, advance, width, glyph_height, x_offset, y_offset, bitmap_address
+            )
+            bitmap_address += len(bitmap)
+        glyphs_address = self.add(glyph_table)
+
+        kerning_address = 0
+        if target.kerning:
+            kerning_address = self.add(
+                b"".join(target.kerning_pair(*pair) for pair in kerning_pairs)
+            )
+
+        descriptor = target.font_descriptor(
+            height,
+            int(avg_width + 0.5),
+            len(glyphs),
+            glyphs_address,
+            len(kerning_pairs),
+            kerning_address,
+        )
+        self.add_entry(name, ENTRY_FONT, self.add(descriptor))
+
+    def add_image(self, name, image_path, pixel_format, width=None, height=None):
+        img = load_and_resize_image(image_path, width, height)
+        image_data = convert_image_to_format(img, pixel_format)
+        format_info = PIXEL_FORMATS[pixel_format]
+
+        descriptor = self.target.image_descriptor(
+            img.width,
+            img.height,
+            calculate_stride(img.width, format_info["bits_per_pixel"]),
+            len(image_data),
+            self.add(image_data),
+            format_info["zephyr_value"],
+        )
+        self.add_entry(name, ENTRY_IMAGE, self.add(descriptor))
+
+    def finish(self):
+        target = self.target
+        offset = HEADER.size
+        for name, entry_type, entry_offset in self.entries:
+            ENTRY.pack_into(self.data, offset, name, entry_type, entry_offset)
+            offset += ENTRY.size
+
+        HEADER.pack_into(
+            self.data,
+            0,
+            BUNDLE_MAGIC,
+            BUNDLE_VERSION,
+            target.pointer_size,
+            0,
+            len(self.data),
+            zlib.crc32(self.data[HEADER.size :]),
+            self.base,
+            len(target.font_descriptor(0, 0, 0, 0)),
+            len(target.glyph()),
+            len(target.kerning_pair()) if target.kerning else 0,
+            len(target.image_descriptor()),
+            len(self.entries),
+            0,
+        )
+        return bytes(self.data)
+
+
+def generate_bundle(manifest_path, target, base):
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+
+    root = os.path.dirname(os.path.abspath(manifest_path))
+    fonts = manifest.get("fonts", [])
+    images = manifest.get("images", [])
+    bundle = Bundle(target, base, len(fonts) + len(images))
+
+    for font in fonts:
+        codes = parse_character_ranges(font.get("range"))
+        bundle.add_font(font["name"], os.path.join(root, font["file"]), font["size"], codes)
+
+    for image in images:
+        bundle.add_image(
+            image["name"],
+            os.path.join(root, image["file"]),
+            image["format"],
+            image.get("width"),
+            image.get("height"),
+        )
+
+    return bundle.finish()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Pack fonts and images into a MicroUI asset bundle",
+        epilog="""
+Examples:
+  %(prog)s -o theme.bin theme.json
+  %(prog)s --base 0x10200000 --kerning -o theme.bin theme.json
+
+The layout options must match the configuration of the firmware, the bundle
+is rejected by mu_bundle_open() otherwise.
+        """,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+
+    parser.add_argument("manifest", help="JSON manifest listing the fonts and images")
+    parser.add_argument("-o", "--output", required=True, help="Output bundle file")
+    parser.add_argument(
+        "--base",
+        type=lambda value: int(value, 0),
+        default=0,
+        help="Address the bundle is mapped at, e.g. of its XIP flash partition (default: 0)",
+    )
+    parser.add_argument(
+        "--pointer-size",
+        type=int,
+        choices=[4, 8],
+        default=4,
+        help="Pointer size of the target in bytes (default: 4)",
+    )
+    parser.add_argument(
+        "--kerning",
+        action="store_true",
+        help="Include kerning tables, for CONFIG_MICROUI_FONT_KERNING",
+    )
+    parser.add_argument(
+        "--asset-storage",
+        action="store_true",
+        help="Descriptors have a storage field, for CONFIG_MICROUI_ASSET_STORAGE",
+    )
+
+    args = parser.parse_args()
+
+    if args.base % BUNDLE_ALIGN:
+        parser.error(f"Base address must be aligned to {BUNDLE_ALIGN} bytes")
+
+    target = Target(args.pointer_size, args.kerning, args.asset_storage)
+
+    try:
+        data = generate_bundle(args.manifest, target, args.base)
+        if args.base + len(data) > 1 << (8 * args.pointer_size):
+            raise ValueError("Bundle does not fit the address space of the target")
+
+        with open(args.output, "wb") as f:
+            f.write(data)
+    except Exception as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+
+    print(f"Bundle written to: {args.output} ({len(data)} bytes)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,7 +1,6 @@
 from PIL import Image, ImageDraw, ImageFont
 import argparse
 import os
-import math
 
 try:
     from fontTools.ttLib import TTFont
@@ -70,9 +69,12 @@ def parse_character_ranges(range_string):
     return sorted(list(characters))
 
 
-def generate_font_data(
-    ttf_path, font_size, output_path, character_codes=None, font_name=None
-):
+def render_font(ttf_path, font_size, character_codes=None):
+    """Render the glyphs and collect the kerning pairs of a font.
+
+    Returns (height, avg_width, glyphs, kerning_pairs), with glyphs as returned
+    by generate_single_glyph().
+    """
     if not os.path.isfile(ttf_path):
         raise FileNotFoundError(f"Font file not found: {ttf_path}")
 
@@ -90,32 +92,34 @@ def generate_font_data(
 
     font_height, max_width, avg_width = measure_font_dimensions(font, character_codes)
 
-    # Support bitmap widths up to 64 bits (8 bytes per row) for large fonts
-    bitmap_width = max(8, 2 ** math.ceil(math.log2(max(max_width, 1))))
-    if bitmap_width > 64:
-        raise ValueError(f"Character width {max_width} exceeds maximum supported bitmap width of 64 bits")
-    bytes_per_row = bitmap_width // 8
-
     print(f"Font height: {font_height}")
     print(f"Character widths: avg={avg_width:.1f}, max={max_width}")
-    print(f"Bitmap width: {bitmap_width} bits ({bytes_per_row} bytes per row)")
     if character_codes:
         print(
             f"Character range: {min(character_codes)}-{max(character_codes)} ({len(character_codes)} requested)"
         )
 
-    glyphs = generate_variable_width_glyphs(
-        font, bitmap_width, font_height, character_codes
-    )
+    glyphs = generate_variable_width_glyphs(font, font_height, character_codes)
     kerning_pairs = generate_kerning_pairs(ttf_path, font_size, character_codes)
     print(f"Generated {len(glyphs)} character glyphs")
     print(f"Generated {len(kerning_pairs)} kerning pairs")
 
+    return font_height, avg_width, glyphs, kerning_pairs
+
+
+def generate_font_data(
+    ttf_path, font_size, output_path, character_codes=None, font_name=None, section=None
+):
+    if character_codes is None:
+        character_codes = list(range(32, 128))
+
+    font_height, avg_width, glyphs, kerning_pairs = render_font(
+        ttf_path, font_size, character_codes
+    )
+
     write_c_file(
         output_path,
-        bitmap_width,
         font_height,
-        bytes_per_row,
         glyphs,
         kerning_pairs,
         ttf_path,
@@ -123,6 +127,7 @@ def generate_font_data(
         avg_width,
         character_codes,
         font_name,
+        section,
     )
     print(f"Font data written to: {output_path}")
 
@@ -167,67 +172,91 @@ def measure_font_dimensions(font, character_codes):
     return font_height, max_width, avg_width
 
 
-def generate_variable_width_glyphs(font, bitmap_width, font_height, character_codes):
+def generate_variable_width_glyphs(font, font_height, character_codes):
     if not character_codes:
         return []
 
     glyphs = []
-    bytes_per_row = bitmap_width // 8
 
     for code in character_codes:
-        glyph = generate_single_glyph(
-            font, code, bitmap_width, font_height, bytes_per_row
-        )
+        glyph = generate_single_glyph(font, code, font_height)
         glyphs.append(glyph)
 
     return glyphs
 
 
-def generate_single_glyph(font, code, bitmap_width, font_height, bytes_per_row):
+def pack_glyph_bitmap(img, bbox):
+    """Pack the pixels inside bbox row by row, 1 bit per pixel, MSB first.
+
+    Rows are not padded, so a row can start in the middle of a byte. Only the
+    last byte of the glyph is padded.
+    """
+    left, top, right, bottom = bbox
+    bitmap = []
+    byte_val = 0
+    bit = 0
+
+    for y in range(top, bottom):
+        for x in range(left, right):
+            if img.getpixel((x, y)):
+                byte_val |= 0x80 >> bit
+            bit += 1
+            if bit == 8:
+                bitmap.append(byte_val)
+                byte_val = 0
+                bit = 0
+
+    if bit:
+        bitmap.append(byte_val)
+
+    return bitmap
+
+
+def generate_single_glyph(font, code, font_height):
+    """Render a glyph and crop it to the bounding box of its inked pixels.
+
+    Returns (codepoint, advance, x_offset, y_offset, width, height, bitmap),
+    where the offsets locate the bounding box relative to the pen position at
+    the top of the line. Ink left of the pen position or past the advance is
+    cut off, as text bounds are the sum of the advances and the renderer
+    relies on glyphs staying within them.
+    """
     try:
         char = chr(code)
     except ValueError:
-        bitmap = [0] * (font_height * bytes_per_row)
-        return (code, 4, bitmap)
-
-    measure_img = Image.new("1", (bitmap_width * 2, font_height * 2), color=0)
-    measure_draw = ImageDraw.Draw(measure_img)
+        return (code, 4, 0, 0, 0, 0, [])
 
-    char_width = 0
-    bitmap = [0] * (font_height * bytes_per_row)
+    advance = 0
 
     try:
-        advance = font.getlength(char)
-        char_width = int(round(advance))
-        char_width = min(char_width, bitmap_width)
+        advance = int(round(font.getlength(char)))
 
         if code == 32:
-            char_width = max(4, char_width // 2)
-
-        if char_width > 0 and code != 32:
-            img = Image.new("1", (bitmap_width, font_height), color=0)
-            draw = ImageDraw.Draw(img)
-
-            draw.text((0, 0), char, font=font, fill=1)
-
-            for y in range(font_height):
-                for byte_idx in range(bytes_per_row):
-                    byte_val = 0
-                    for bit in range(8):
-                        x = byte_idx * 8 + bit
-                        if x < bitmap_width:
-                            try:
-                                if img.getpixel((x, y)):
-                                    byte_val |= 0x80 >> bit
-                            except:
-                                pass
-                    bitmap[y * bytes_per_row + byte_idx] = byte_val
+            advance = max(4, advance // 2)
+
+        if advance <= 0 or code == 32:
+            return (code, advance, 0, 0, 0, 0, [])
+
+        img = Image.new("1", (advance, font_height), color=0)
+        draw = ImageDraw.Draw(img)
+        draw.text((0, 0), char, font=font, fill=1)
+
+        bbox = img.getbbox()
+        if bbox is None:
+            return (code, advance, 0, 0, 0, 0, [])
+
+        left, top, right, bottom = bbox
+        if left > 127 or right - left > 255:
+            raise ValueError(f"glyph extent {right - left} at {left} does not fit")
 
+        bitmap = pack_glyph_bitmap(img, bbox)
+        return (code, advance, left, top, right - left, bottom - top, bitmap)
+
+    except ValueError:
+        raise
     except Exception as e:
         print(f"Warning: Could not render character {code} ('{char}'): {e}")
-        char_width = 4 if code == 32 else 6
-
-    return (code, char_width, bitmap)
+        return (code, advance or (4 if code == 32 else 6), 0, 0, 0, 0, [])
 
 
 def get_x_adjustment(value_record):
@@ -404,9 +433,7 @@ def generate_kerning_pairs(ttf_path, font_size, character_codes):
 
 def write_c_file(
     output_path,
-    bitmap_width,
     height,
-    bytes_per_row,
     glyphs,
     kerning_pairs,
     source_font,
@@ -414,6 +441,7 @@ def write_c_file(
     avg_width,
     character_codes,
     font_name=None,
+    section=None,
 ):
     # Use provided font name or derive from output filename
     if font_name:
@@ -431,37 +459,47 @@ def write_c_file(
         f.write(" * Variable Width Bitmap Font Data\n")
         f.write(f" * Generated from: {os.path.basename(source_font)}\n")
         f.write(f" * Font size: {size} pixels\n")
-        f.write(f" * Bitmap size: {bitmap_width}x{height} pixels\n")
+        f.write(f" * Line height: {height} pixels\n")
         f.write(f" * Average character width: {avg_width:.1f} pixels\n")
         f.write(
             f" * Character range: {first_char}-{last_char} ({len(character_codes)} requested, {len(glyphs)} total)\n"
         )
-        f.write(" * Format: Variable width, 1 bit per pixel\n")
+        f.write(" * Format: Variable width, 1 bit per pixel, cropped to the inked pixels\n")
         f.write(" */\n\n")
 
         f.write("#include <stdint.h>\n")
+        if section:
+            f.write("#include <zephyr/toolchain.h>\n")
         f.write("#include <microui/font.h>\n\n")
 
-        f.write(f"const uint8_t {font_name}_bitmaps[] = {{\n")
+        attributes = f" Z_GENERIC_SECTION({section})" if section else ""
+        f.write(f"const uint8_t {font_name}_bitmaps[]{attributes} = {{\n")
         bitmap_offset = 0
         bitmap_offsets = []
 
-        for _, _, bitmap in glyphs:
+        for glyph in glyphs:
+            bitmap = glyph[6]
             bitmap_offsets.append(bitmap_offset)
-            hex_values = [f"0x{b:02X}" for b in bitmap]
-            f.write("    " + ", ".join(hex_values) + ",\n")
+            if bitmap:
+                hex_values = [f"0x{b:02X}" for b in bitmap]
+                f.write("    " + ", ".join(hex_values) + ",\n")
             bitmap_offset += len(bitmap)
 
+        if bitmap_offset == 0:
+            # C does not allow empty arrays
+            f.write("    0x00,\n")
+
         f.write("};\n\n")
 
         f.write(f"const struct mu_FontGlyph {font_name}_glyphs[] = {{\n")
-        for i, (unicode, width, bitmap) in enumerate(glyphs):
+        for i, (unicode, advance, x_offset, y_offset, width, glyph_height, _) in enumerate(glyphs):
             f.write(
-                f"    {{{unicode}u, {width:2d}, {height:2d}, &{font_name}_bitmaps[{bitmap_offsets[i]}]}}"
+                f"    {{{unicode}u, {advance:2d}, {width:2d}, {glyph_height:2d}, {x_offset:2d}, {y_offset:2d},"
+                f" &{font_name}_bitmaps[{bitmap_offsets[i]}]}}"
             )
             if i < len(glyphs) - 1:
                 f.write(",")
-            f.write(f" // {format_char_name(unicode)} (width: {width})\n")
+            f.write(f" // {format_char_name(unicode)} (advance: {advance})\n")
         f.write("};\n\n")
 
         f.write("#ifdef CONFIG_MICROUI_FONT_KERNING\n")
@@ -479,8 +517,6 @@ def write_c_file(
 
         f.write(f"const struct mu_FontDescriptor {font_name} = {{\n")
         f.write(f"    .height = {height},\n")
-        f.write(f"    .bitmap_width = {bitmap_width},\n")
-        f.write(f"    .bytes_per_row = {bytes_per_row},\n")
         f.write(f"    .default_width = {int(avg_width + 0.5)},\n")
         f.write("    .char_spacing = 1,\n")
         f.write(f"    .glyph_count = {len(glyphs)},\n")
@@ -519,10 +555,11 @@ Examples:
   %(prog)s arial.ttf 12 font_arial_12.c
   %(prog)s -r "32-127,224,227-229" arial.ttf 16 font_arial_16.c
   %(prog)s --range "65-90,97-122" /System/Library/Fonts/Monaco.ttf 16 font_mono_16.c
+  %(prog)s --range-file chars.txt arial.ttf 16 font_arial_16.c
 
 Features:
   - Variable character widths for better typography
-  - Automatic bitmap width optimization
+  - Glyphs cropped to their inked pixels, with bearings
   - Configurable character spacing
   - Support for custom character ranges
         """,
@@ -542,17 +579,34 @@ Features:
         help="C identifier name for the font. If not provided, derived from output filename.",
     )
     parser.add_argument(
+        "--section",
+        help="Linker section for the glyph bitmaps (e.g., .microui_assets.font)",
+    )
+    range_group = parser.add_mutually_exclusive_group()
+    range_group.add_argument(
         "-r",
         "--range",
         dest="char_range",
         help='Character ranges to generate (e.g., "32-127,224,227-229"). Default: 32-127',
     )
+    range_group.add_argument(
+        "--range-file",
+        dest="range_file",
+        help="Read the character ranges from a file, e.g. one written by microui_font_subset.py",
+    )
 
     args = parser.parse_args()
 
     if args.size < 4 or args.size > 128:
         parser.error(f"Font size {args.size} out of range (4-128)")
 
+    if args.range_file:
+        try:
+            with open(args.range_file) as f:
+                args.char_range = f.read().strip()
+        except OSError as e:
+            parser.error(f"Cannot read range file: {e}")
+
     try:
         character_codes = parse_character_ranges(args.char_range)
         if not character_codes:
@@ -562,7 +616,12 @@ Features:
 
     try:
         generate_font_data(
-            args.font_file, args.size, args.output, character_codes, args.font_name
+            args.font_file,
+            args.size,
+            args.output,
+            character_codes,
+            args.font_name,
+            args.section,
         )
         print("\nSuccess! Font supports variable character widths.")
         print("Text will now render with proper character spacing.")
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+MicroUI Font Subsetter
+
+This script collects the characters an application displays, so the font
+generator only has to produce glyphs for them. It reads the string literals of
+C/C++ sources and gettext catalogs (.po/.pot), and the whole text of any other
+file, and writes a character range list for microui_font_gen.py.
+
+Copyright (c) 2025 Fabian Blatz <fabianblatz@gmail.com>
+SPDX-License-Identifier: Apache-2.0
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Files whose string literals are scanned, everything else is read as text
+LITERAL_EXTENSIONS = {".c", ".h", ".cc", ".cpp", ".hpp", ".cxx", ".po", ".pot"}
+
+# Comments, character literals and string literals with optional prefix
+C_TOKEN = re.compile(
+    r"""
+    //[^\n]*
+    | /\*.*?\*/
+    | (?:u8|u|U|L)?'(?:\\.|[^'\\\n])*'
+    | (?:u8|u|U|L)?"((?:\\.|[^"\\\n])*)"
+    """,
+    re.S | re.X,
+)
+
+C_ESCAPE = re.compile(
+    r"\\(?:x([0-9A-Fa-f]+)|u([0-9A-Fa-f]{4})|U([0-9A-Fa-f]{8})|([0-7]{1,3})|(.))", re.S
+)
+
+SIMPLE_ESCAPES = {
+    "n": "\n",
+    "t": "\t",
+    "r": "\r",
+    "a": "\a",
+    "b": "\b",
+    "f": "\f",
+    "v": "\v",
+}
+
+
+def decode_c_string(literal):
+    """Resolve the escape sequences of a C string literal body."""
+
+    def replace(match):
+        hex_value, ucn4, ucn8, octal, other = match.groups()
+        if hex_value is not None:
+            return chr(int(hex_value, 16))
+        if ucn4 is not None or ucn8 is not None:
+            return chr(int(ucn4 or ucn8, 16))
+        if octal is not None:
+            return chr(int(octal, 8))
+        return SIMPLE_ESCAPES.get(other, other)
+
+    text = C_ESCAPE.sub(replace, literal)
+
+    # Byte escapes like "\xC3\xA4" spell UTF-8 sequences, decode them as such
+    if all(ord(char) < 0x100 for char in text):
+        try:
+            text = text.encode("latin-1").decode("utf-8")
+        except UnicodeDecodeError:
+            pass
+
+    return text
+
+
+def collect_file(path):
+    with open(path, encoding="utf-8", errors="replace") as f:
+        content = f.read()
+
+    if os.path.splitext(path)[1].lower() not in LITERAL_EXTENSIONS:
+        return set(content)
+
+    characters = set()
+    for match in C_TOKEN.finditer(content):
+        if match.group(1) is not None:
+            characters.update(decode_c_string(match.group(1)))
+    return characters
+
+
+def format_ranges(codes):
+    """Format sorted codepoints as a range list, e.g. "32,48-57,65-90"."""
+    ranges = []
+    for code in codes:
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code])
+
+    return ",".join(str(a) if a == b else f"{a}-{b}" for a, b in ranges)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Collect the characters used by an application for microui_font_gen.py",
+        epilog="""
+Examples:
+  %(prog)s src/*.c
+  %(prog)s -r "48-57" -o chars.txt src/main.c translations/de.po
+  %(prog)s src/main.c > chars.txt && microui_font_gen.py --range-file chars.txt font.ttf 16 font.c
+        """,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+
+    parser.add_argument("files", nargs="+", help="Source files, gettext catalogs or text files")
+    parser.add_argument(
+        "-r",
+        "--range",
+        dest="char_range",
+        help='Characters to always include, e.g. digits shown by printf (e.g., "48-57")',
+    )
+    parser.add_argument("-o", "--output", help="Output file, defaults to stdout")
+
+    args = parser.parse_args()
+
+    # Space is needed for layout even when no string contains one
+    codes = {32}
+
+    if args.char_range:
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        from microui_font_gen import parse_character_ranges
+
+        try:
+            codes.update(parse_character_ranges(args.char_range))
+        except ValueError as e:
+            parser.error(f"Invalid character range: {e}")
+
+    for path in args.files:
+        try:
+            codes.update(ord(char) for char in collect_file(path))
+        except OSError as e:
+            print(f"Error: {e}", file=sys.stderr)
+            return 1
+
+    # Control characters have no glyph
+    codes = sorted(code for code in codes if code >= 32 and code != 127)
+    ranges = format_ranges(codes)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(ranges + "\n")
+    else:
+        print(ranges)
+
+    return 0
+
+
+if __name__ == "__main__":
+    exit(main())
@@ -20,41 +20,49 @@ import sys
 PIXEL_FORMATS = {
     "RGB_888": {
         "zephyr_enum": "PIXEL_FORMAT_RGB_888",
+        "zephyr_value": 1 << 0,
         "bits_per_pixel": 24,
         "description": "24-bit RGB",
     },
     "MONO01": {
         "zephyr_enum": "PIXEL_FORMAT_MONO01",
+        "zephyr_value": 1 << 1,
         "bits_per_pixel": 1,
         "description": "Monochrome (0=Black 1=White)",
     },
     "MONO10": {
         "zephyr_enum": "PIXEL_FORMAT_MONO10",
+        "zephyr_value": 1 << 2,
         "bits_per_pixel": 1,
         "description": "Monochrome (1=Black 0=White)",
     },
     "ARGB_8888": {
         "zephyr_enum": "PIXEL_FORMAT_ARGB_8888",
+        "zephyr_value": 1 << 3,
         "bits_per_pixel": 32,
         "description": "32-bit ARGB",
     },
     "RGB_565": {
         "zephyr_enum": "PIXEL_FORMAT_RGB_565",
+        "zephyr_value": 1 << 4,
         "bits_per_pixel": 16,
         "description": "16-bit RGB (5-6-5)",
     },
     "BGR_565": {
         "zephyr_enum": "PIXEL_FORMAT_RGB_565X",
+        "zephyr_value": 1 << 5,
         "bits_per_pixel": 16,
         "description": "16-bit BGR (5-6-5) byte swapped",
     },
     "L_8": {
         "zephyr_enum": "PIXEL_FORMAT_L_8",
+        "zephyr_value": 1 << 6,
         "bits_per_pixel": 8,
         "description": "8-bit Grayscale/Luminance",
     },
     "AL_88": {
         "zephyr_enum": "PIXEL_FORMAT_AL_88",
+        "zephyr_value": 1 << 7,
         "bits_per_pixel": 16,
         "description": "8-bit Grayscale/Luminance with alpha",
     },
@@ -310,7 +318,7 @@ def calculate_stride(width, bits_per_pixel):
         return width * (bits_per_pixel // 8)
 
 
-def write_c_file(output_path, img, pixel_format, image_data, image_name=None):
+def write_c_file(output_path, img, pixel_format, image_data, image_name=None, section=None):
     """Write the image data to a C file."""
 
     if image_name is None:
@@ -336,10 +344,14 @@ def write_c_file(output_path, img, pixel_format, image_data, image_name=None):
         f.write(" */\n\n")
 
         f.write("#include <microui/image.h>\n")
-        f.write("#include <zephyr/drivers/display.h>\n\n")
+        f.write("#include <zephyr/drivers/display.h>\n")
+        if section:
+            f.write("#include <zephyr/toolchain.h>\n")
+        f.write("\n")
 
         # Write image data array
-        f.write(f"static const uint8_t {image_name}_data[] = {{\n")
+        attributes = f" Z_GENERIC_SECTION({section})" if section else ""
+        f.write(f"static const uint8_t {image_name}_data[]{attributes} = {{\n")
 
         # Write data in rows of 12 bytes for readability
         bytes_per_line = 12
@@ -410,6 +422,11 @@ Examples:
         help="Image name for C identifier (default: derived from output filename)",
     )
 
+    parser.add_argument(
+        "--section",
+        help="Linker section for the pixel data (e.g., .microui_assets.image)",
+    )
+
     args = parser.parse_args()
 
     try:
@@ -421,7 +438,7 @@ Examples:
         image_data = convert_image_to_format(img, args.format)
 
         # Write C file
-        write_c_file(args.output, img, args.format, image_data, args.name)
+        write_c_file(args.output, img, args.format, image_data, args.name, args.section)
 
         print(f"Successfully generated: {args.output}")
         print(f"Image size: {img.width}x{img.height}")
@@ -0,0 +1,203 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/display.h>
+#include <microui/zmu.h>
+#include <microui/accel.h>
+#include <microui/image.h>
+#include <string.h>
+
+#define DISPLAY_NODE   DT_CHOSEN(zephyr_display)
+#define DISPLAY_WIDTH  DT_PROP(DISPLAY_NODE, width)
+#define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
+
+#define QUEUE_SIZE 64
+
+static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
+
+static uint8_t image_data[8 * 6 * 2];
+static const struct mu_ImageDescriptor image = {
+	.width = 8,
+	.height = 6,
+	.stride = 8 * 2,
+	.data_size = sizeof(image_data),
+	.data = image_data,
+	.pixel_format = PIXEL_FORMAT_RGB_565,
+	.compression = MU_IMAGE_COMPRESSION_NONE,
+};
+
+/*
+ * Test double queueing operations and running them on the software
+ * reference backend only when waited for, like an accelerator running in the
+ * background. Drawing in software without waiting first shows up as a
+ * difference to the software renderer.
+ */
+struct deferred_op {
+	bool blit;
+	const struct mu_AccelSurface *dst;
+	mu_Rect rect;
+	uint32_t pixel;
+	mu_Vec2 pos;
+	const struct mu_ImageDescriptor *src;
+};
+
+static struct {
+	struct deferred_op queue[QUEUE_SIZE];
+	int queued;
+	int fills;
+	int blits;
+	int waits;
+	bool reject;
+	const struct mu_AccelSurface *target;
+} deferred;
+
+static int deferred_submit(struct deferred_op op)
+{
+	if (deferred.reject) {
+		return -ENOTSUP;
+	}
+	if (deferred.queued == QUEUE_SIZE) {
+		return -EBUSY;
+	}
+
+	deferred.target = op.dst;
+	deferred.queue[deferred.queued++] = op;
+	return 0;
+}
+
+static int deferred_fill(const struct mu_Accel *accel, const struct mu_AccelSurface *dst,
+			 mu_Rect rect, uint32_t pixel)
+{
+	int ret = deferred_submit((struct deferred_op){.dst = dst, .rect = rect, .pixel = pixel});
+
+	deferred.fills += (ret == 0);
+	return ret;
+}
+
+static int deferred_blit(const struct mu_Accel *accel, const struct mu_AccelSurface *dst,
+			 mu_Vec2 pos, const struct mu_ImageDescriptor *src, mu_Rect src_rect)
+{
+	int ret = deferred_submit(
+		(struct deferred_op){.blit = true, .dst = dst, .rect = src_rect, .pos = pos, .src = src});
+
+	deferred.blits += (ret == 0);
+	return ret;
+}
+
+static int deferred_wait(const struct mu_Accel *accel)
+{
+	for (int i = 0; i < deferred.queued; i++) {
+		struct deferred_op *op = &deferred.queue[i];
+
+		if (op->blit) {
+			mu_accel_sw.blit(&mu_accel_sw, op->dst, op->pos, op->src, op->rect);
+		} else {
+			mu_accel_sw.fill(&mu_accel_sw, op->dst, op->rect, op->pixel);
+		}
+	}
+
+	deferred.queued = 0;
+	deferred.waits++;
+	return 0;
+}
+
+static const struct mu_Accel deferred_accel = {
+	.fill = deferred_fill,
+	.blit = deferred_blit,
+	.wait = deferred_wait,
+};
+
+static void scene(mu_Context *ctx)
+{
+	mu_begin(ctx);
+	if (mu_begin_window_ex(ctx, "Accel", mu_rect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT),
+			       MU_OPT_NOTITLE)) {
+		mu_draw_rect(ctx, mu_rect(4, 4, 20, 10), mu_color(200, 40, 40, 255));
+		mu_draw_image(ctx, mu_vec2(10, 8), (mu_Image)&image);
+		/* Drawn in software over the accelerated commands before it */
+		mu_draw_circle(ctx, mu_vec2(16, 12), 6, mu_color(40, 200, 40, 255));
+		mu_draw_rect(ctx, mu_rect(14, 10, 30, 20), mu_color(40, 40, 200, 255));
+		/* Partially clipped by the window body */
+		mu_Rect body = mu_get_clip_rect(ctx);
+		mu_draw_image(ctx, mu_vec2(body.x + body.w - 4, body.y + 4), (mu_Image)&image);
+		mu_end_window(ctx);
+	}
+	mu_end(ctx);
+}
+
+static uint8_t *render_accelerated(void)
+{
+	mu_accel_set(&deferred_accel);
+	mu_handle_tick();
+	mu_accel_set(NULL);
+
+	zassert_not_null(deferred.target, "no operation was submitted");
+	return deferred.target->buf;
+}
+
+static void check_matches_software(uint8_t *buf)
+{
+	static uint8_t accelerated[DISPLAY_WIDTH * DISPLAY_HEIGHT * 2];
+	size_t size = deferred.target->stride * deferred.target->height;
+
+	zassert_true(size <= sizeof(accelerated));
+	memcpy(accelerated, buf, size);
+
+	mu_handle_tick();
+	zassert_mem_equal(accelerated, buf, size, "accelerated frame differs from software");
+}
+
+ZTEST(microui_accel, test_matches_software)
+{
+	uint8_t *buf = render_accelerated();
+
+	zassert_true(deferred.fills > 0);
+	zassert_equal(deferred.blits, 2);
+	check_matches_software(buf);
+}
+
+ZTEST(microui_accel, test_batches_until_cpu_access)
+{
+	render_accelerated();
+
+	/* Waits only before the circle and before presenting */
+	zassert_equal(deferred.queued, 0, "operations pending after the frame");
+	zassert_equal(deferred.waits, 2);
+	zassert_true(deferred.fills + deferred.blits > deferred.waits);
+}
+
+ZTEST(microui_accel, test_unsupported_falls_back)
+{
+	uint8_t *buf = render_accelerated();
+
+	deferred.reject = true;
+	deferred.fills = 0;
+	deferred.blits = 0;
+	deferred.waits = 0;
+	mu_accel_set(&deferred_accel);
+	mu_handle_tick();
+	mu_accel_set(NULL);
+
+	zassert_equal(deferred.fills + deferred.blits + deferred.waits, 0);
+	check_matches_software(buf);
+}
+
+static void *accel_suite_setup(void)
+{
+	for (int i = 0; i < sizeof(image_data); i++) {
+		image_data[i] = i * 37;
+	}
+
+	display_set_pixel_format(display_dev, PIXEL_FORMAT_RGB_565);
+	mu_setup(scene);
+	/* Let the window settle its layout, so all frames are identical */
+	mu_handle_tick();
+
+	return NULL;
+}
+
+static void accel_before(void *f)
+{
+	memset(&deferred, 0, sizeof(deferred));
+}
+
+ZTEST_SUITE(microui_accel, NULL, accel_suite_setup, accel_before, NULL, NULL);
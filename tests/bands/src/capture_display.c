@@ -0,0 +1,70 @@
+/*
+ * Display driver keeping a copy of the frames written to it, so tests can
+ * compare rendered output.
+ */
+
+#define DT_DRV_COMPAT vnd_capture_display
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <string.h>
+#include "capture_display.h"
+
+#define CAPTURE_WIDTH  DT_INST_PROP(0, width)
+#define CAPTURE_HEIGHT DT_INST_PROP(0, height)
+
+static uint8_t frame[CAPTURE_WIDTH * CAPTURE_HEIGHT * 2];
+
+const uint8_t *capture_display_frame(size_t *size)
+{
+	*size = sizeof(frame);
+	return frame;
+}
+
+static int capture_write(const struct device *dev, const uint16_t x, const uint16_t y,
+			 const struct display_buffer_descriptor *desc, const void *buf)
+{
+	const uint8_t *src = buf;
+
+	if (x + desc->width > CAPTURE_WIDTH || y + desc->height > CAPTURE_HEIGHT) {
+		return -EINVAL;
+	}
+
+	for (int row = 0; row < desc->height; row++) {
+		memcpy(&frame[((y + row) * CAPTURE_WIDTH + x) * 2], &src[row * desc->pitch * 2],
+		       desc->width * 2);
+	}
+
+	return 0;
+}
+
+static int capture_blanking_off(const struct device *dev)
+{
+	return 0;
+}
+
+static void capture_get_capabilities(const struct device *dev,
+				     struct display_capabilities *caps)
+{
+	memset(caps, 0, sizeof(*caps));
+	caps->x_resolution = CAPTURE_WIDTH;
+	caps->y_resolution = CAPTURE_HEIGHT;
+	caps->supported_pixel_formats = PIXEL_FORMAT_RGB_565;
+	caps->current_pixel_format = PIXEL_FORMAT_RGB_565;
+}
+
+static int capture_set_pixel_format(const struct device *dev,
+				    const enum display_pixel_format pixel_format)
+{
+	return pixel_format == PIXEL_FORMAT_RGB_565 ? 0 : -ENOTSUP;
+}
+
+static DEVICE_API(display, capture_api) = {
+	.blanking_off = capture_blanking_off,
+	.write = capture_write,
+	.get_capabilities = capture_get_capabilities,
+	.set_pixel_format = capture_set_pixel_format,
+};
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, NULL, NULL, POST_KERNEL, CONFIG_DISPLAY_INIT_PRIORITY,
+		      &capture_api);
@@ -0,0 +1,10 @@
+#ifndef CAPTURE_DISPLAY_H_
+#define CAPTURE_DISPLAY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Last frame written to the display, RGB 565 without row padding */
+const uint8_t *capture_display_frame(size_t *size);
+
+#endif /* CAPTURE_DISPLAY_H_ */
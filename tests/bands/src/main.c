@@ -0,0 +1,88 @@
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <microui/zmu.h>
+#include <microui/font.h>
+#include <string.h>
+#include "capture_display.h"
+
+#define DISPLAY_NODE   DT_CHOSEN(zephyr_display)
+#define DISPLAY_WIDTH  DT_PROP(DISPLAY_NODE, width)
+#define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
+
+#define MAX_BANDS (CONFIG_MICROUI_RENDER_BAND_THREADS + 1)
+
+MU_FONT_DECLARE(montserrat_12);
+
+static uint8_t expected[DISPLAY_WIDTH * DISPLAY_HEIGHT * 2];
+static int offset;
+
+/* Text and shapes crossing the band boundaries, moved by offset */
+static void scene(mu_Context *ctx)
+{
+	mu_begin(ctx);
+	if (mu_begin_window(ctx, "Bands", mu_rect(offset, offset, DISPLAY_WIDTH - 10,
+						   DISPLAY_HEIGHT - 10))) {
+		mu_layout_row(ctx, 2, (int[]){60, -1}, 0);
+		mu_label(ctx, "Label");
+		mu_button(ctx, "Button");
+		mu_layout_row(ctx, 1, (int[]){-1}, 0);
+		mu_text(ctx, "The quick brown fox jumps over the lazy dog, "
+			     "then over the band boundaries and out of the window.");
+
+		mu_Rect body = mu_get_current_container(ctx)->body;
+
+		mu_draw_circle(ctx, mu_vec2(body.x + 20, 60), 14, mu_color(200, 40, 40, 255));
+		mu_draw_arc(ctx, mu_vec2(body.x + 60, 40), 18, 5, 30, 300,
+			    mu_color(40, 200, 40, 255));
+		mu_draw_line(ctx, mu_vec2(body.x, 25), mu_vec2(body.x + body.w + 20, 95), 3,
+			     mu_color(240, 240, 0, 255));
+		mu_draw_triangle(ctx, mu_vec2(body.x + 90, 20), mu_vec2(body.x + 140, 70),
+				 mu_vec2(body.x + 80, 110), mu_color(0, 100, 255, 255));
+		mu_end_window(ctx);
+	}
+	mu_end(ctx);
+}
+
+static const uint8_t *render(int bands, size_t *size)
+{
+	zassert_ok(mu_set_render_bands(bands));
+	mu_handle_tick();
+
+	return capture_display_frame(size);
+}
+
+ZTEST(microui_bands, test_bands_match_single_band)
+{
+	for (offset = 0; offset < 10; offset += 3) {
+		size_t size;
+		const uint8_t *frame;
+
+		/* Let the window settle its layout, then take the reference frame */
+		render(1, &size);
+		frame = render(1, &size);
+		memcpy(expected, frame, size);
+
+		for (int bands = 2; bands <= MAX_BANDS; bands++) {
+			frame = render(bands, &size);
+			zassert_mem_equal(frame, expected, size, "%d bands differ at offset %d",
+					  bands, offset);
+		}
+	}
+}
+
+ZTEST(microui_bands, test_band_count_range)
+{
+	zassert_equal(mu_set_render_bands(0), -EINVAL);
+	zassert_equal(mu_set_render_bands(MAX_BANDS + 1), -EINVAL);
+	zassert_ok(mu_set_render_bands(MAX_BANDS));
+}
+
+static void *bands_suite_setup(void)
+{
+	mu_setup(scene);
+	mu_set_font(mu_get_context(), &montserrat_12);
+
+	return NULL;
+}
+
+ZTEST_SUITE(microui_bands, NULL, bands_suite_setup, NULL, NULL, NULL);